@@ -0,0 +1,160 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BoardContext.h"
+#include "Evaluate5CardHand.h"
+#include "Card.h"
+#include "PlayInfo.h"
+
+namespace NHandUtils
+{
+    CBoardContext::CBoardContext( const std::vector< std::shared_ptr< CCard > >& cards, std::optional< size_t > numHoleCards ) :
+        fCards( cards ),
+        fNumHoleCards( numHoleCards )
+    {
+        std::array< TPackedCard, 32 > packedCards;
+        if ( !toPackedCards( fCards, packedCards.data(), packedCards.size() ) )
+            return;
+
+        auto packedSpan = SCardSpan( packedCards.data(), fCards.size() );
+        for ( auto&& ii : packedSpan )
+        {
+            auto rank = ( ii >> 8 ) & 0x0F;
+            if ( rank < fRankCounts.size() )
+                fRankCounts[ rank ]++;
+            fSuitCounts[ ( ii >> 12 ) & 0x0F ]++;
+        }
+
+        for ( size_t ii = 0; ( ii < fPartials.size() ) && ( ii <= fCards.size() ); ++ii )
+            fPartials[ ii ] = partialHands( packedSpan, ii );
+
+        auto&& cardInfoData = C5CardInfo::cardInfoData();
+        for ( auto&& straightsAndFlushesCount : { false, true } )
+        {
+            for ( auto&& lowHandWins : { false, true } )
+            {
+                auto&& best = fBoardBest[ SCardInfoData::toWhichItem( straightsAndFlushesCount, lowHandWins ) ];
+                for ( auto&& ii : fPartials[ 5 ] )
+                {
+                    auto rank = cardInfoData.evaluateCardHand( ii.fRanks, ii.fProduct, ii.fSuits != 0, straightsAndFlushesCount, lowHandWins, false );
+                    if ( rank < best.fRank )
+                        best = { rank, 0, ii.fMask };
+                }
+            }
+        }
+    }
+
+    uint8_t CBoardContext::rankCount( ECard card ) const
+    {
+        auto rank = toRankValue( card );
+        if ( rank >= fRankCounts.size() )
+            return 0;
+        return fRankCounts[ rank ];
+    }
+
+    uint8_t CBoardContext::suitCount( ESuit suit ) const
+    {
+        return fSuitCounts[ static_cast< uint8_t >( suit ) ];
+    }
+
+    SHoleAndBoardBest CBoardContext::evaluate( SCardSpan holeCards, const std::shared_ptr< SPlayInfo >& playInfo ) const
+    {
+        // any 5 cards is the best over each number of hole cards, the board only hand is shared
+        auto minHoleCards = fNumHoleCards.value_or( ( fCards.size() >= 5 ) ? 0 : ( 5 - fCards.size() ) );
+        auto maxHoleCards = fNumHoleCards.value_or( std::min< size_t >( 5, holeCards.size() ) );
+
+        SHoleAndBoardBest retVal;
+        for ( auto ii = minHoleCards; ii <= maxHoleCards; ++ii )
+        {
+            if ( ( ii > 5 ) || ( ii > holeCards.size() ) || ( ( 5 - ii ) > fCards.size() ) )
+                continue;
+
+            SHoleAndBoardBest best;
+            if ( ii == 0 )
+            {
+                best = fBoardBest[ SCardInfoData::toWhichItem( playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins ) ];
+                if ( ( best.fRank != kNoRank ) && playInfo->hasWildCards() )
+                    best.fRank += 13;
+            }
+            else
+                best = findBestHoleAndBoard( holeCards, ii, fPartials[ 5 - ii ], playInfo );
+            if ( best.fRank < retVal.fRank )
+                retVal = best;
+        }
+        return retVal;
+    }
+
+    SBestHand CBoardContext::findBestHand( const std::vector< std::shared_ptr< CCard > >& holeCards, const std::shared_ptr< SPlayInfo >& playInfo ) const
+    {
+        if ( playInfo->hasWildCards() )
+        {
+            if ( fNumHoleCards.has_value() )
+                return findBestHoleAndBoard( holeCards, fNumHoleCards.value(), fCards, playInfo );
+
+            auto cards = holeCards;
+            cards.insert( cards.end(), fCards.begin(), fCards.end() );
+            return evaluateBestHand( cards, playInfo );
+        }
+
+        std::array< TPackedCard, 32 > packedCards;
+        if ( !toPackedCards( holeCards, packedCards.data(), packedCards.size() ) )
+            return SBestHand();
+
+        auto best = evaluate( SCardSpan( packedCards.data(), holeCards.size() ), playInfo );
+        if ( best.fRank == kNoRank )
+            return SBestHand();
+
+        SBestHand retVal;
+        retVal.fRank = best.fRank;
+        for ( size_t ii = 0; ii < holeCards.size(); ++ii )
+        {
+            if ( best.fHoleMask & ( 1U << ii ) )
+                retVal.fCards.push_back( holeCards[ ii ] );
+        }
+        for ( size_t ii = 0; ii < fCards.size(); ++ii )
+        {
+            if ( best.fBoardMask & ( 1U << ii ) )
+                retVal.fCards.push_back( fCards[ ii ] );
+        }
+        return retVal;
+    }
+
+    SHiLoRanks CBoardContext::hiLoRanks( const std::vector< std::shared_ptr< CCard > >& holeCards, const std::shared_ptr< SPlayInfo >& playInfo ) const
+    {
+        if ( !fNumHoleCards.has_value() )
+        {
+            auto cards = holeCards;
+            cards.insert( cards.end(), fCards.begin(), fCards.end() );
+            return evaluateHiLo( cards, playInfo );
+        }
+
+        SHiLoRanks retVal;
+        retVal.fHigh = findBestHand( holeCards, playInfo ).fRank;
+
+        auto numHoleCards = fNumHoleCards.value();
+        std::array< TPackedCard, 32 > packedCards;
+        if ( ( numHoleCards > 5 ) || !toPackedCards( holeCards, packedCards.data(), packedCards.size() ) )
+            return retVal;
+        retVal.fLow = findBestLow( SCardSpan( packedCards.data(), holeCards.size() ), numHoleCards, fPartials[ 5 - numHoleCards ], playInfo );
+        return retVal;
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef __BOARDCONTEXT_H
+#define __BOARDCONTEXT_H
+
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "HandUtils.h"
+#include <memory>
+#include <vector>
+#include <array>
+#include <optional>
+
+class CCard;
+struct SPlayInfo;
+enum class ECard;
+enum class ESuit : uint8_t;
+
+namespace NHandUtils
+{
+    // The community cards of a deal, shared by every player at the table
+    // the board is reduced once to its rank counts, suit counts, the partial hands of every board subset and the best board only hand
+    // so each player only folds in their hole cards, see findBestHoleAndBoard
+    // numHoleCards is the exact number of hole cards a hand must use, omaha is 2, unset plays any 5 of the hole and board cards
+    class CBoardContext
+    {
+    public:
+        CBoardContext( const std::vector< std::shared_ptr< CCard > >& cards, std::optional< size_t > numHoleCards = {} );
+
+        const std::vector< std::shared_ptr< CCard > > & cards() const { return fCards; }
+        size_t size() const { return fCards.size(); }
+        bool empty() const { return fCards.empty(); }
+        std::optional< size_t > numHoleCards() const { return fNumHoleCards; }
+
+        uint8_t rankCount( ECard card ) const;
+        uint8_t suitCount( ESuit suit ) const;
+
+        // same rules as evaluateHand( SCardSpan ), wild cards are not substituted
+        SHoleAndBoardBest evaluate( SCardSpan holeCards, const std::shared_ptr< SPlayInfo >& playInfo ) const;
+        // wild cards are substituted
+        SBestHand findBestHand( const std::vector< std::shared_ptr< CCard > >& holeCards, const std::shared_ptr< SPlayInfo >& playInfo ) const;
+        // both halves of a hi/lo split, with numHoleCards set each half uses exactly that many hole cards
+        SHiLoRanks hiLoRanks( const std::vector< std::shared_ptr< CCard > >& holeCards, const std::shared_ptr< SPlayInfo >& playInfo ) const;
+    private:
+        std::vector< std::shared_ptr< CCard > > fCards;
+        std::optional< size_t > fNumHoleCards;
+        std::array< uint8_t, 13 > fRankCounts{}; // indexed by the rank value of the card
+        std::array< uint8_t, 16 > fSuitCounts{}; // indexed by the one hot suit bits
+        std::array< std::vector< SPartialHand >, 6 > fPartials; // indexed by the number of board cards
+        std::array< SHoleAndBoardBest, 4 > fBoardBest; // the best hand of board cards only, indexed by EWhichItem, without the wild card offset
+    };
+}
+
+#endif
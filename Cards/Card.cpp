@@ -266,31 +266,32 @@ CCard::~CCard()
 
 }
 
+// built once by the first caller, the simulation workers may all ask for the deck at once
 std::vector< std::shared_ptr< CCard > > CCard::allCards()
 {
-    static std::vector< std::shared_ptr< CCard > > retVal;
-    if ( retVal.empty() )
+    static const auto retVal = []()
     {
+        std::vector< std::shared_ptr< CCard > > cards;
         for ( const auto&& currSuit : ESuit() )
         {
             for ( const auto&& currCard : ECard() )
             {
                 auto card = std::make_shared< CCard >( currCard, currSuit );
-                retVal.push_back( card );
+                cards.push_back( card );
             }
         }
-    }
+        return cards;
+    }();
     return retVal;
 }
 
 std::list< std::shared_ptr< CCard > > CCard::allCardsList()
 {
-    static std::list< std::shared_ptr< CCard > > retVal;
-    if ( retVal.empty() )
+    static const auto retVal = []()
     {
         auto allCards = CCard::allCards();
-        retVal = { allCards.begin(), allCards.end() };
-    }
+        return std::list< std::shared_ptr< CCard > >( allCards.begin(), allCards.end() );
+    }();
     return retVal;
 }
 
@@ -92,6 +92,7 @@ public:
     static std::list< std::shared_ptr< CCard > > allCardsList();
     QString toString( bool verbose, bool includeBitValue ) const;
     NHandUtils::TCardBitType bitValue() const{ return fBitValue; }
+    NHandUtils::TPackedCard packedValue() const{ return static_cast< NHandUtils::TPackedCard >( fBitValue.to_ulong() ); }
 
     ESuit getSuit() const{ return fSuit; }
     ECard getCard() const { return fCard; }
@@ -29,6 +29,8 @@
 #include "Evaluate3CardHand.h"
 #include "Evaluate4CardHand.h"
 #include "Evaluate5CardHand.h"
+#include "Evaluate6CardHand.h"
+#include "Evaluate7CardHand.h"
 
 #include <map>
 #include <set>
@@ -37,6 +39,19 @@
 #include <algorithm>
 #include <unordered_map>
 #include <fstream>
+#include <mutex>
+
+// the AVX2 batch evaluator is compiled for AVX2 on its own and picked at runtime when the cpu has it
+#if defined( __AVX2__ ) || ( defined( CARDS_ENABLE_AVX2 ) && ( defined( __x86_64__ ) || defined( _M_X64 ) ) )
+#define CARDS_AVX2_BATCH
+#include <immintrin.h>
+#if defined( _MSC_VER )
+#include <intrin.h>
+#define CARDS_AVX2_TARGET
+#else
+#define CARDS_AVX2_TARGET __attribute__( ( target( "avx2" ) ) )
+#endif
+#endif
 
 namespace NHandUtils
 {
@@ -333,47 +348,251 @@ namespace NHandUtils
         return oss;
     }
 
-    const std::vector< uint32_t > & SCardInfoData::getUniqueVector( bool straightsAndFlushesCount, bool lowHandWins ) const
+    const STable< uint32_t > & SCardInfoData::getUniqueVector( bool straightsAndFlushesCount, bool lowHandWins ) const
     {
         auto whichItem = getWhichItem( straightsAndFlushesCount, lowHandWins );
         return fUniqueVectors[ whichItem ];
     }
 
+    // kept out of SCardInfoData so the generated instances stay constant initialized
+    // one slot per table, each is built once and never changed after, so the lookups need no lock
+    struct SLegacyProductMaps
+    {
+        std::once_flag fBuilt;
+        std::array< std::unordered_map< int64_t, int16_t >, 4 > fMaps;
+    };
+
+    static SLegacyProductMaps * legacyProductMaps( const SCardInfoData * data )
+    {
+        static std::array< SLegacyProductMaps, 6 > sProductMaps;
+        static const std::array< const SCardInfoData *, 6 > sTables = { &C2CardInfo::cardInfoData(), &C3CardInfo::cardInfoData(), &C4CardInfo::cardInfoData(), &C5CardInfo::cardInfoData(), &C6CardInfo::sCardInfoData, &C7CardInfo::sCardInfoData };
+        for ( size_t ii = 0; ii < sTables.size(); ++ii )
+        {
+            if ( sTables[ ii ] == data )
+                return &sProductMaps[ ii ];
+        }
+        return nullptr;
+    }
+
     const std::unordered_map< int64_t, int16_t > & SCardInfoData::getProductMap( bool straightsAndFlushesCount, bool lowHandWins ) const
     {
+        static const std::unordered_map< int64_t, int16_t > sNoProducts;
+        auto productMaps = legacyProductMaps( this );
+        if ( !productMaps || !fTablesInitialized.load( std::memory_order_acquire ) )
+            return sNoProducts;
+
+        std::call_once( productMaps->fBuilt, [ this, productMaps ]()
+            {
+                for ( auto&& ii : fProductIndex.fEntries )
+                {
+                    for ( size_t jj = 0; jj < 4; ++jj )
+                        productMaps->fMaps[ jj ][ ii.fProduct ] = ii.fRanks[ jj ];
+                }
+            } );
         auto whichItem = getWhichItem( straightsAndFlushesCount, lowHandWins );
-        return fProductMaps[ whichItem ];
+        return productMaps->fMaps[ whichItem ];
+    }
+
+    uint32_t SCardInfoData::legacyProductRank( uint64_t product, bool straightsAndFlushesCount, bool lowHandWins, uint32_t wildCardOffset ) const
+    {
+        auto && productMap = getProductMap( straightsAndFlushesCount, lowHandWins );
+        auto pos = productMap.find( product );
+        if ( pos == productMap.end() )
+            return -1;
+        return ( *pos ).second + wildCardOffset;
     }
 
-    const std::map< THand, uint32_t > & SCardInfoData::getCardMap( bool straightsAndFlushesCount, bool lowHandWins ) const
+    const STable< SCardMapEntry > & SCardInfoData::getCardMap( bool straightsAndFlushesCount, bool lowHandWins ) const
     {
         auto whichItem = getWhichItem( straightsAndFlushesCount, lowHandWins );
         return fCardMaps[ whichItem ];
     }
 
-    uint32_t SCardInfoData::evaluateCardHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo, size_t expectedSize )
+    uint32_t SCardInfoData::evaluateCardHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo, size_t expectedSize ) const
+    {
+        if ( cards.size() != expectedSize )
+            return -1;
+
+        TPackedHand< 5 > packedCards;
+        auto numCards = toPackedCards( cards, packedCards.data(), packedCards.size() );
+        if ( numCards != expectedSize )
+            return -1;
+        return evaluateCardHand( SCardSpan( packedCards.data(), numCards ), playInfo, expectedSize );
+    }
+
+    uint32_t SCardInfoData::evaluateCardHand( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo, size_t expectedSize ) const
     {
         if ( cards.size() != expectedSize )
             return -1;
 
+        auto wildCardOffset = playInfo->hasWildCards() ? 13 : 0;
         auto cardsValue = NHandUtils::getCardsValue( cards );
-        if ( playInfo && playInfo->fStraightsAndFlushesCount )
+        if ( playInfo->fStraightsAndFlushesCount )
         {
             if ( NHandUtils::isFlush( cards ) )
-                return fFlushes[ cardsValue ] + ( playInfo->hasWildCards() ? 13 : 0 );
+                return fFlushes[ cardsValue ] + wildCardOffset;
         }
 
         auto && straightOrHighCardVector = getUniqueVector( playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins );
         auto straightOrHighCard = straightOrHighCardVector[ cardsValue ];
         if ( straightOrHighCard )
-            return straightOrHighCard + ( playInfo->hasWildCards() ? 13 : 0 );
+            return straightOrHighCard + wildCardOffset;
 
         auto product = computeHandProduct( cards );
-        auto && productMap = getProductMap( playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins );
-        auto pos = productMap.find( product );
-        if ( pos == productMap.end() )
+        if ( gUseLegacyProductMaps.load( std::memory_order_relaxed ) )
+            return legacyProductRank( product, playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins, wildCardOffset );
+
+        auto entry = fProductIndex.find( product );
+        if ( !entry )
             return -1;
-        return ( *pos ).second + ( playInfo->hasWildCards() ? 13 : 0 );
+        return entry->fRanks[ getWhichItem( playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins ) ] + wildCardOffset;
+    }
+
+#if defined( CARDS_AVX2_BATCH )
+    static bool cpuHasAVX2()
+    {
+#if defined( __AVX2__ )
+        return true;
+#elif defined( _MSC_VER )
+        int info[ 4 ];
+        __cpuid( info, 0 );
+        if ( info[ 0 ] < 7 )
+            return false;
+        __cpuid( info, 1 );
+        auto osxsaveAndAVX = ( 1 << 27 ) | ( 1 << 28 );
+        if ( ( ( info[ 2 ] & osxsaveAndAVX ) != osxsaveAndAVX ) || ( ( _xgetbv( 0 ) & 0x6 ) != 0x6 ) )
+            return false;
+        __cpuidex( info, 7, 0 );
+        return ( info[ 1 ] & ( 1 << 5 ) ) != 0;
+#else
+        return __builtin_cpu_supports( "avx2" );
+#endif
+    }
+
+    // 8 hands at a time, the flush test, rank or and prime product are computed per lane 
+    // and the flush and unique tables gathered, paired hands are looked up in the product index one lane at a time
+    // returns the number of hands evaluated
+    CARDS_AVX2_TARGET static size_t evaluateCardHandsAVX2( const SCardInfoData & data, SCardSpan cards, size_t handSize, bool straightsAndFlushesCount, bool lowHandWins, uint32_t wildCardOffset, uint32_t * ranks )
+    {
+        auto numHands = cards.size() / handSize;
+        auto offsets = _mm256_mullo_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_epi32( static_cast< int >( handSize ) ) );
+        auto allOnes = _mm256_set1_epi32( -1 );
+        auto zero = _mm256_setzero_si256();
+        auto whichItem = SCardInfoData::toWhichItem( straightsAndFlushesCount, lowHandWins );
+        auto flushes = reinterpret_cast< const int * >( data.fFlushes.data() );
+        auto uniqueValues = reinterpret_cast< const int * >( data.fUniqueVectors[ whichItem ].data() );
+
+        size_t ii = 0;
+        for ( ; ( ii + 8 ) <= numHands; ii += 8 )
+        {
+            auto base = reinterpret_cast< const int * >( cards.begin() + ii * handSize );
+            auto andValue = allOnes;
+            auto orValue = zero;
+            auto product = _mm256_set1_epi32( 1 );
+            for ( size_t jj = 0; jj < handSize; ++jj )
+            {
+                auto card = _mm256_i32gather_epi32( base + jj, offsets, 4 );
+                andValue = _mm256_and_si256( andValue, card );
+                orValue = _mm256_or_si256( orValue, card );
+                product = _mm256_mullo_epi32( product, _mm256_and_si256( card, _mm256_set1_epi32( 0x00FF ) ) );
+            }
+
+            auto cardsValue = _mm256_srli_epi32( orValue, 16 );
+            auto rank = _mm256_i32gather_epi32( uniqueValues, cardsValue, 4 );
+            auto isFlush = zero;
+            if ( straightsAndFlushesCount )
+            {
+                isFlush = _mm256_xor_si256( _mm256_cmpeq_epi32( _mm256_and_si256( andValue, _mm256_set1_epi32( 0x0F000 ) ), zero ), allOnes );
+                rank = _mm256_blendv_epi8( rank, _mm256_mask_i32gather_epi32( zero, flushes, cardsValue, isFlush, 4 ), isFlush );
+            }
+            auto paired = _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_andnot_si256( isFlush, _mm256_cmpeq_epi32( rank, zero ) ) ) );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( ranks + ii ), _mm256_add_epi32( rank, _mm256_set1_epi32( static_cast< int >( wildCardOffset ) ) ) );
+            if ( !paired )
+                continue;
+
+            alignas( 32 ) uint32_t products[ 8 ];
+            _mm256_store_si256( reinterpret_cast< __m256i * >( products ), product );
+            for ( int lane = 0; lane < 8; ++lane )
+            {
+                if ( ( paired & ( 1 << lane ) ) == 0 )
+                    continue;
+                auto entry = data.fProductIndex.find( products[ lane ] );
+                ranks[ ii + lane ] = entry ? ( entry->fRanks[ whichItem ] + wildCardOffset ) : -1;
+            }
+        }
+        return ii;
+    }
+#endif
+
+    void SCardInfoData::evaluateCardHands( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo, size_t handSize, uint32_t * ranks ) const
+    {
+        if ( handSize == 0 )
+            return;
+
+        auto numHands = cards.size() / handSize;
+        size_t ii = 0;
+#if defined( CARDS_AVX2_BATCH )
+        static const bool sHasAVX2 = cpuHasAVX2();
+        if ( sHasAVX2 && !gUseLegacyProductMaps.load( std::memory_order_relaxed ) && ( handSize <= 5 ) )
+        {
+            ii = evaluateCardHandsAVX2( *this, cards, handSize, playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins, playInfo->hasWildCards() ? 13 : 0, ranks );
+        }
+#endif
+        for ( ; ii < numHands; ++ii )
+            ranks[ ii ] = evaluateCardHand( SCardSpan( cards.begin() + ii * handSize, handSize ), playInfo, handSize );
+    }
+
+    void SProductIndex::build( const std::map< uint64_t, std::array< uint16_t, 4 > >& productRanks, std::vector< uint32_t > & displacements, std::vector< SEntry > & entries )
+    {
+        auto numProducts = productRanks.size();
+        std::vector< std::vector< std::map< uint64_t, std::array< uint16_t, 4 > >::const_iterator > > buckets( numBuckets( numProducts ) );
+        for ( auto ii = productRanks.begin(); ii != productRanks.end(); ++ii )
+            buckets[ reduce( hash( ( *ii ).first, 0 ), buckets.size() ) ].push_back( ii );
+
+        // largest buckets first, while the table is still mostly empty
+        std::vector< size_t > order( buckets.size() );
+        for ( size_t ii = 0; ii < order.size(); ++ii )
+            order[ ii ] = ii;
+        std::stable_sort( order.begin(), order.end(), [ &buckets ]( size_t lhs, size_t rhs ) { return buckets[ lhs ].size() > buckets[ rhs ].size(); } );
+
+        displacements.assign( buckets.size(), 0 );
+        entries.assign( numProducts, SEntry{ 0, { 0, 0, 0, 0 } } );
+        std::vector< bool > used( numProducts, false );
+        std::vector< size_t > slots;
+        for ( auto&& bucket : order )
+        {
+            if ( buckets[ bucket ].empty() )
+                continue;
+
+            for ( uint32_t displacement = 1; ; ++displacement )
+            {
+                slots.clear();
+                bool found = true;
+                for ( auto&& ii : buckets[ bucket ] )
+                {
+                    auto slot = reduce( hash( ( *ii ).first, displacement ), numProducts );
+                    if ( used[ slot ] || ( std::find( slots.begin(), slots.end(), slot ) != slots.end() ) )
+                    {
+                        found = false;
+                        break;
+                    }
+                    slots.push_back( slot );
+                }
+                if ( !found )
+                    continue;
+
+                displacements[ bucket ] = displacement;
+                for ( size_t ii = 0; ii < slots.size(); ++ii )
+                {
+                    used[ slots[ ii ] ] = true;
+                    auto && entry = entries[ slots[ ii ] ];
+                    entry.fProduct = ( *buckets[ bucket ][ ii ] ).first;
+                    for ( size_t jj = 0; jj < 4; ++jj )
+                        entry.fRanks[ jj ] = ( *buckets[ bucket ][ ii ] ).second[ jj ];
+                }
+                break;
+            }
+        }
     }
 
 }
\ No newline at end of file
@@ -27,6 +27,10 @@
 #include "HandUtils.h"
 #include <memory>
 #include <map>
+#include <array>
+#include <algorithm>
+#include <unordered_map>
+#include <atomic>
 #include <iostream>
 #include "SABUtils/utils.h"
 enum class EHand;
@@ -34,14 +38,55 @@ struct SPlayInfo;
 
 namespace NHandUtils
 {
-    struct SCardInfoData
+    // Minimal perfect hash from the prime product of a paired hand to its rank for each EWhichItem
+    // bucket = hash( product, 0 ), slot = hash( product, fDisplacements[ bucket ] )
+    // so a lookup reads one displacement and one 16 byte entry
+    struct SProductIndex
     {
-        SCardInfoData()
+        struct SEntry
         {
-            fCardMaps.resize( 4 );
-            fUniqueVectors.resize( 4 );
-            fProductMaps.resize( 4 );
+            uint64_t fProduct;
+            uint16_t fRanks[ 4 ];
+        };
+
+        static uint64_t hash( uint64_t product, uint64_t seed )
+        {
+            auto retVal = product ^ ( seed * 0x9E3779B97F4A7C15ULL );
+            retVal ^= retVal >> 33;
+            retVal *= 0xff51afd7ed558ccdULL;
+            retVal ^= retVal >> 33;
+            retVal *= 0xc4ceb9fe1a85ec53ULL;
+            retVal ^= retVal >> 33;
+            return retVal;
         }
+        static size_t reduce( uint64_t hashValue, size_t size ) { return static_cast< size_t >( ( ( hashValue >> 32 ) * size ) >> 32 ); }
+        static size_t numBuckets( size_t numProducts ) { return std::max( static_cast< size_t >( 1 ), ( numProducts + 3 ) / 4 ); }
+
+        const SEntry * find( uint64_t product ) const
+        {
+            if ( fEntries.empty() )
+                return nullptr;
+            auto bucket = reduce( hash( product, 0 ), fDisplacements.size() );
+            auto && entry = fEntries[ reduce( hash( product, fDisplacements[ bucket ] ), fEntries.size() ) ];
+            return ( entry.fProduct == product ) ? &entry : nullptr;
+        }
+
+        // the caller owns the storage, the generator writes it out as constant arrays
+        static void build( const std::map< uint64_t, std::array< uint16_t, 4 > > & productRanks, std::vector< uint32_t > & displacements, std::vector< SEntry > & entries );
+
+        STable< uint32_t > fDisplacements;
+        STable< SEntry > fEntries;
+    };
+
+    struct SCardMapEntry
+    {
+        TCard fCards[ 5 ]; // unused cards are left as ESuit::eUNKNOWN
+        uint32_t fRank;
+    };
+
+    // plain aggregate of table views so the generated instances are constant initialized, no runtime construction is needed
+    struct SCardInfoData
+    {
         enum EWhichItem
         {
             eStraightsAndFlushesDontCountLowBall = 0,
@@ -50,27 +95,85 @@ namespace NHandUtils
             eStraightsAndFlushesCount = 3
         };
 
-        EWhichItem getWhichItem( bool straightsAndFlushesCount, bool lowHandWins ) const
+        static constexpr EWhichItem toWhichItem( bool straightsAndFlushesCount, bool lowHandWins )
         {
-            auto whichItem =
+            return
                 straightsAndFlushesCount
                 ? ( lowHandWins ? EWhichItem::eStraightsAndFlushesCountLowBall : EWhichItem::eStraightsAndFlushesCount )
                 : ( lowHandWins ? EWhichItem::eStraightsAndFlushesDontCountLowBall : EWhichItem::eStraightsAndFlushesDontCount )
                 ;
-            return whichItem;
         }
-        const std::vector< uint32_t > & getUniqueVector( bool straightsAndFlushesCount, bool lowHandWins ) const;
-        const std::unordered_map< int64_t, int16_t > & getProductMap( bool straightsAndFlushesCount, bool lowHandWins ) const;
-        const std::map< THand, uint32_t > & getCardMap( bool straightsAndFlushesCount, bool lowHandWins ) const;
+        EWhichItem getWhichItem( bool straightsAndFlushesCount, bool lowHandWins ) const
+        {
+            return toWhichItem( straightsAndFlushesCount, lowHandWins );
+        }
+        const STable< uint32_t > & getUniqueVector( bool straightsAndFlushesCount, bool lowHandWins ) const;
+        const std::unordered_map< int64_t, int16_t > & getProductMap( bool straightsAndFlushesCount, bool lowHandWins ) const; // legacy lookup, built from fProductIndex on first use
+        uint32_t legacyProductRank( uint64_t product, bool straightsAndFlushesCount, bool lowHandWins, uint32_t wildCardOffset ) const; // the getProductMap lookup, -1 when no hand has the product
+        const STable< SCardMapEntry > & getCardMap( bool straightsAndFlushesCount, bool lowHandWins ) const;
+
+        uint32_t evaluateCardHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo, size_t expectedSize ) const;
+        uint32_t evaluateCardHand( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo, size_t expectedSize ) const;
+        // the rules are fixed at compile time, see bindHandEvaluator, always uses the product index
+        template< bool StraightsAndFlushesCount, bool LowHandWins, bool WildCards >
+        uint32_t evaluateCardHand( SCardSpan cards, size_t expectedSize ) const
+        {
+            if ( cards.size() != expectedSize )
+                return -1;
+
+            constexpr auto whichItem = toWhichItem( StraightsAndFlushesCount, LowHandWins );
+            constexpr uint32_t wildCardOffset = WildCards ? 13 : 0;
+            auto cardsValue = NHandUtils::getCardsValue( cards );
+            if constexpr ( StraightsAndFlushesCount )
+            {
+                if ( NHandUtils::isFlush( cards ) )
+                    return fFlushes[ cardsValue ] + wildCardOffset;
+            }
+
+            auto straightOrHighCard = fUniqueVectors[ whichItem ][ cardsValue ];
+            if ( straightOrHighCard )
+                return straightOrHighCard + wildCardOffset;
+
+            auto entry = fProductIndex.find( computeHandProduct( cards ) );
+            if ( !entry )
+                return -1;
+            return entry->fRanks[ whichItem ] + wildCardOffset;
+        }
+        // the cards are given by their rank bits, prime product and whether they are all one suit, see CIncrementalHand
+        uint32_t evaluateCardHand( uint16_t cardsValue, uint64_t product, bool flush, bool straightsAndFlushesCount, bool lowHandWins, bool wildCards ) const
+        {
+            uint32_t wildCardOffset = wildCards ? 13 : 0;
+            if ( straightsAndFlushesCount && flush )
+                return fFlushes[ cardsValue ] + wildCardOffset;
+
+            auto whichItem = toWhichItem( straightsAndFlushesCount, lowHandWins );
+            auto straightOrHighCard = fUniqueVectors[ whichItem ][ cardsValue ];
+            if ( straightOrHighCard )
+                return straightOrHighCard + wildCardOffset;
+
+            if ( gUseLegacyProductMaps.load( std::memory_order_relaxed ) )
+                return legacyProductRank( product, straightsAndFlushesCount, lowHandWins, wildCardOffset );
 
-        uint32_t evaluateCardHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo, size_t expectedSize );
+            auto entry = fProductIndex.find( product );
+            if ( !entry )
+                return -1;
+            return entry->fRanks[ whichItem ] + wildCardOffset;
+        }
+        EHand rankToCardHand( uint32_t rank, bool straightsAndFlushesCount, bool lowHandWins, bool wildCards ) const
+        {
+            return lookupHandType( fHandsByRank[ toWhichItem( straightsAndFlushesCount, lowHandWins ) ], rank, wildCards );
+        }
+        // cards holds handSize cards per hand back to back, one rank per hand is written to ranks
+        // uses AVX2 gathers when built with CARDS_ENABLE_AVX2 and the cpu supports them
+        void evaluateCardHands( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo, size_t handSize, uint32_t * ranks ) const;
 
-        std::vector< std::vector< uint32_t > > fUniqueVectors;
-        std::vector< std::map< THand, uint32_t > > fCardMaps;
-        std::vector< std::unordered_map< int64_t, int16_t > > fProductMaps;
-        std::vector< uint32_t > fFlushes;
+        STable< uint32_t > fFlushes;
+        STable< uint32_t > fUniqueVectors[ 4 ];
+        SProductIndex fProductIndex;
+        STable< EHand > fHandsByRank[ 4 ]; // see lookupHandType
+        STable< SCardMapEntry > fCardMaps[ 4 ]; // only filled in when the tables are generated with __USECARDMAPS
         bool fAllHandsComputed{false};
-        bool fTablesInitialized{false};
+        std::atomic< bool > fTablesInitialized{false}; // set with release once the tables can be read from any thread, see CTableRegistry
     };
 
     class CCardInfo
@@ -125,10 +228,6 @@ namespace NHandUtils
         void computeAndGenerateMap( std::ostream& oss, T& map, bool straightsAndFlushesCount, bool lowBall ) const;
         template< typename T1, typename T2, typename T3, typename T4 >
         void computeAndGenerateMaps( std::ostream& oss, size_t size, T1& straightsAndFlushesDontCount, T2& straightsAndFlushesCount, T3& justCardsLowCount, T4& straightsAndFlushesLowCount ) const;
-        template< typename T >
-        void generateITE( std::ostream& oss, size_t size, const T& map, bool straightsAndFlushesCount, bool lowBall ) const;
-        template< typename T1, typename T2, typename T3, typename T4 >
-        void generateRankFunction( std::ostream& oss, size_t size, const T1& straightsAndFlushesDontCount, const T2& straightsAndFlushesCount, const T3& straightsAndFlushesDontCountLowBall, const T4& straightsAndFlushesLowCount ) const;
 
         void setOrigCards( const THand& cards ); // returns the cards sorted
         void setupKickers();
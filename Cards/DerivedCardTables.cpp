@@ -0,0 +1,133 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "DerivedCardTables.h"
+#include "Evaluate5CardHand.h"
+#include "HandUtils.h"
+#include "Card.h"
+
+#include <bitset>
+#include <algorithm>
+
+namespace NHandUtils
+{
+    // calls func with the prime product and distinct ranks of every multiset of numCards ranks, no rank more than 4 times
+    template< typename T >
+    static void forEachRankMultiset( size_t numCards, T func, size_t firstRank = 0, uint64_t product = 1, uint16_t ranks = 0 )
+    {
+        if ( numCards == 0 )
+        {
+            func( product, ranks );
+            return;
+        }
+        for ( auto rank = firstRank; rank < 13; ++rank )
+        {
+            auto prime = toPrimeValue( static_cast< ECard >( rank ) );
+            auto currProduct = product;
+            for ( size_t count = 1; ( count <= 4 ) && ( count <= numCards ); ++count )
+            {
+                currProduct *= prime;
+                forEachRankMultiset( numCards - count, func, rank + 1, currProduct, ranks | ( 1 << rank ) );
+            }
+        }
+    }
+
+    // best of the multisets with one less card, the N card multiset minus one card of each distinct rank
+    static TRanksByProduct bestOfOneLess( size_t numCards, const TRanksByProduct & oneLess )
+    {
+        TRanksByProduct retVal;
+        forEachRankMultiset( numCards,
+            [ &retVal, &oneLess ]( uint64_t product, uint16_t ranks )
+            {
+                std::array< uint16_t, 4 > best = { 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF };
+                for ( uint8_t rank = 0; rank < 13; ++rank )
+                {
+                    if ( ( ranks & ( 1 << rank ) ) == 0 )
+                        continue;
+                    auto pos = oneLess.find( product / toPrimeValue( static_cast< ECard >( rank ) ) );
+                    if ( pos == oneLess.end() )
+                        continue;
+                    for ( size_t ii = 0; ii < best.size(); ++ii )
+                        best[ ii ] = std::min( best[ ii ], ( *pos ).second[ ii ] );
+                }
+                retVal[ product ] = best;
+            } );
+        return retVal;
+    }
+
+    const std::vector< uint32_t > & bestFlushes()
+    {
+        static const auto sFlushes = []()
+        {
+            C5CardInfo::initMaps();
+            auto && fiveCardData = C5CardInfo::sCardInfoData;
+
+            // the best 5 card subset of each rank mask
+            std::vector< uint32_t > retVal( 1 << 13, 0 );
+            for ( uint16_t mask = 0; mask < ( 1 << 13 ); ++mask )
+            {
+                auto numBits = std::bitset< 13 >( mask ).count();
+                if ( numBits < 5 )
+                    continue;
+                if ( numBits == 5 )
+                {
+                    retVal[ mask ] = fiveCardData.fFlushes[ mask ];
+                    continue;
+                }
+                uint32_t best = -1;
+                for ( uint16_t bit = 1; bit < ( 1 << 13 ); bit <<= 1 )
+                {
+                    if ( mask & bit )
+                        best = std::min( best, retVal[ mask & ~bit ] );
+                }
+                retVal[ mask ] = best;
+            }
+            return retVal;
+        }();
+        return sFlushes;
+    }
+
+    TRanksByProduct bestRanksByProduct( size_t numCards )
+    {
+        C5CardInfo::initMaps();
+        auto && fiveCardData = C5CardInfo::sCardInfoData;
+
+        // 5 card ranks from the unique and product tables then the best of each larger size from the size before
+        TRanksByProduct retVal;
+        forEachRankMultiset( 5,
+            [ &retVal, &fiveCardData ]( uint64_t product, uint16_t ranks )
+            {
+                auto && curr = retVal[ product ];
+                auto entry = fiveCardData.fProductIndex.find( product );
+                for ( size_t ii = 0; ii < curr.size(); ++ii )
+                {
+                    if ( std::bitset< 13 >( ranks ).count() == 5 )
+                        curr[ ii ] = static_cast< uint16_t >( fiveCardData.fUniqueVectors[ ii ][ ranks ] );
+                    else
+                        curr[ ii ] = entry ? entry->fRanks[ ii ] : 0xFFFF;
+                }
+            } );
+        for ( size_t ii = 6; ii <= numCards; ++ii )
+            retVal = bestOfOneLess( ii, retVal );
+        return retVal;
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef __DERIVEDCARDTABLES_H
+#define __DERIVEDCARDTABLES_H
+
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <map>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace NHandUtils
+{
+    // Tables for the best 5 cards of 6 or 7, derived from the C5CardInfo tables, see C6CardInfo and C7CardInfo
+    using TRanksByProduct = std::map< uint64_t, std::array< uint16_t, 4 > >; // indexed by SCardInfoData::EWhichItem
+
+    // the best flush rank of any 13 bit rank mask with at least 5 bits set, 0 for fewer
+    // the same for any number of cards, built once and shared by the 6 and 7 card tables
+    const std::vector< uint32_t > & bestFlushes();
+    // the best rank not counting flushes of every numCards rank multiset, keyed by the prime product
+    TRanksByProduct bestRanksByProduct( size_t numCards );
+}
+
+#endif
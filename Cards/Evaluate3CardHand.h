@@ -45,9 +45,16 @@ namespace NHandUtils
         virtual size_t getNumCards() const override { return 3; }
 
         static uint32_t evaluateCardHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo );
+        static uint32_t evaluateCardHand( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo );
+        template< bool StraightsAndFlushesCount, bool LowHandWins, bool WildCards >
+        static uint32_t evaluateCardHand( SCardSpan cards ) { return sCardInfoData.evaluateCardHand< StraightsAndFlushesCount, LowHandWins, WildCards >( cards, 3 ); }
+        static void evaluateCardHands( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo, uint32_t * ranks );
         static EHand rankToCardHand( uint32_t rank, const std::shared_ptr< SPlayInfo >& playInfo );
+        static const SCardInfoData & cardInfoData() { return sCardInfoData; }
+        static const STable< EHand > & handsByRank( bool straightsAndFlushesCount, bool lowHandWins ) { return sCardInfoData.fHandsByRank[ SCardInfoData::toWhichItem( straightsAndFlushesCount, lowHandWins ) ]; }
 
     private:
+        friend class CTableRegistry;
         static void initMaps();
         static SCardInfoData sCardInfoData;
     };
@@ -0,0 +1,85 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Evaluate6CardHand.h"
+#include "Evaluate5CardHand.h"
+#include "DerivedCardTables.h"
+#include "HandUtils.h"
+#include "Card.h"
+#include "PlayInfo.h"
+
+#include <mutex>
+
+namespace NHandUtils
+{
+    SCardInfoData C6CardInfo::sCardInfoData = {};
+
+    // backing storage for the derived product index, sCardInfoData only holds views, the flushes are shared see bestFlushes
+    static std::vector< uint32_t > sProductDisplacements;
+    static std::vector< SProductIndex::SEntry > sProductEntries;
+
+    void C6CardInfo::initMaps()
+    {
+        static std::once_flag sInitFlag;
+        std::call_once( sInitFlag, buildTables );
+    }
+
+    void C6CardInfo::buildTables()
+    {
+        SProductIndex::build( bestRanksByProduct( 6 ), sProductDisplacements, sProductEntries );
+
+        sCardInfoData.fFlushes = makeTable( bestFlushes() );
+        sCardInfoData.fProductIndex.fDisplacements = makeTable( sProductDisplacements );
+        sCardInfoData.fProductIndex.fEntries = makeTable( sProductEntries );
+        sCardInfoData.fTablesInitialized.store( true, std::memory_order_release );
+    }
+
+    uint32_t C6CardInfo::evaluateCardHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        TPackedHand< 6 > packedCards;
+        if ( toPackedCards( cards, packedCards.data(), packedCards.size() ) != 6 )
+            return -1;
+        return evaluateCardHand( packedCards, playInfo );
+    }
+
+    uint32_t C6CardInfo::evaluateCardHand( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        if ( !sCardInfoData.fTablesInitialized.load( std::memory_order_acquire ) )
+            initMaps();
+        return evaluateCardHandNoInit( cards, playInfo );
+    }
+
+    uint32_t C6CardInfo::evaluateCardHandNoInit( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        static constexpr auto sEvaluators = variantEvaluators< C6CardInfo >();
+        return sEvaluators[ toVariantIndex( playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins, playInfo->hasWildCards() ) ]( cards );
+    }
+
+    EHand C6CardInfo::rankToCardHand( uint32_t rank, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        return C5CardInfo::rankToCardHand( rank, playInfo );
+    }
+
+    const STable< EHand > & C6CardInfo::handsByRank( bool straightsAndFlushesCount, bool lowHandWins )
+    {
+        return C5CardInfo::handsByRank( straightsAndFlushesCount, lowHandWins );
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef __EVALUATE7CARDHAND_H
+#define __EVALUATE7CARDHAND_H
+
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CardInfo.h"
+#include <memory>
+#include <vector>
+#include <array>
+
+struct SPlayInfo;
+enum class EHand;
+
+namespace NHandUtils
+{
+    // Best 5 cards out of 7 in a single pass over the cards, no combinations are enumerated
+    // Not a CCardInfo, the tables are derived from the C5CardInfo tables the first time they are used
+    //     fFlushes      - best flush rank for any 13 bit rank mask with at least 5 bits set
+    //     fProductIndex - best non flush rank for every 7 card rank multiset, keyed by the prime product
+    class C7CardInfo
+    {
+    public:
+        static uint32_t evaluateCardHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo );
+        static uint32_t evaluateCardHand( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo );
+        // no readiness check, the tables must already be built by initMaps() or CTableRegistry::initAll()
+        static uint32_t evaluateCardHandNoInit( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo );
+        // no readiness check and the rules are fixed at compile time, see bindHandEvaluator
+        template< bool StraightsAndFlushesCount, bool LowHandWins, bool WildCards >
+        static uint32_t evaluateCardHand( SCardSpan cards );
+        // no readiness check, the cards are given by their prime product and the rank bits of each suit indexed by the one hot suit bits
+        static uint32_t evaluateCardHandNoInit( uint64_t product, const std::array< uint16_t, 16 > & suitRanks, bool straightsAndFlushesCount, bool lowHandWins, bool wildCards );
+        static EHand rankToCardHand( uint32_t rank, const std::shared_ptr< SPlayInfo >& playInfo );
+        static const STable< EHand > & handsByRank( bool straightsAndFlushesCount, bool lowHandWins ); // the 5 card tables, the ranks are the same
+
+        static void initMaps(); // thread safe, the tables are built once
+        static SCardInfoData sCardInfoData;
+    private:
+        static void buildTables();
+    };
+
+    template< bool StraightsAndFlushesCount, bool LowHandWins, bool WildCards >
+    uint32_t C7CardInfo::evaluateCardHand( SCardSpan cards )
+    {
+        if ( cards.size() != 7 )
+            return -1;
+
+        // indexed by the one hot suit bits
+        std::array< uint16_t, 16 > suitRanks = { 0 };
+        uint64_t product = 1;
+        for ( auto&& ii : cards )
+        {
+            product *= ( ii & 0x00FF );
+            suitRanks[ ( ii >> 12 ) & 0x0F ] |= static_cast< uint16_t >( ii >> 16 );
+        }
+        return evaluateCardHandNoInit( product, suitRanks, StraightsAndFlushesCount, LowHandWins, WildCards );
+    }
+
+    inline uint32_t C7CardInfo::evaluateCardHandNoInit( uint64_t product, const std::array< uint16_t, 16 > & suitRanks, bool straightsAndFlushesCount, bool lowHandWins, bool wildCards )
+    {
+        auto entry = sCardInfoData.fProductIndex.find( product );
+        if ( !entry )
+            return -1;
+
+        uint32_t retVal = entry->fRanks[ SCardInfoData::toWhichItem( straightsAndFlushesCount, lowHandWins ) ];
+        if ( straightsAndFlushesCount )
+        {
+            for ( auto&& suit : { ESuit::eSpades, ESuit::eHearts, ESuit::eDiamonds, ESuit::eClubs } )
+            {
+                auto flush = sCardInfoData.fFlushes[ suitRanks[ static_cast< uint8_t >( suit ) ] ];
+                if ( flush && ( flush < retVal ) )
+                    retVal = flush;
+            }
+        }
+        return retVal + ( wildCards ? 13 : 0 );
+    }
+}
+
+#endif
@@ -25,25 +25,96 @@
 #include "Player.h"
 #include "Hand.h"
 #include "PlayInfo.h"
+#include "BoardContext.h"
+#include "RandomEngine.h"
+#include "Log.h"
 
 #include <random>
+#include <limits>
 #include <unordered_set>
-#include <iostream>
 #include <QLocale>
 #include <QDebug>
 
+void SGameStats::add( const SGameStats & rhs )
+{
+    auto addVector = []( std::vector< uint64_t > & lhs, const std::vector< uint64_t > & rhs )
+    {
+        if ( lhs.size() < rhs.size() )
+            lhs.resize( rhs.size() );
+        for ( size_t ii = 0; ii < rhs.size(); ++ii )
+            lhs[ ii ] += rhs[ ii ];
+    };
+
+    fNumDeals += rhs.fNumDeals;
+    fNumGames += rhs.fNumGames;
+    fLowWins += rhs.fLowWins;
+    addVector( fWinsByHand, rhs.fWinsByHand );
+    addVector( fHandCount, rhs.fHandCount );
+    addVector( fWinsByPlayer, rhs.fWinsByPlayer );
+}
+
+// the engine a game shuffles with unless another is set, seeded from std::random_device
+static std::unique_ptr< CRandomEngine > defaultRandomEngine()
+{
+    std::random_device rd;
+    return std::make_unique< CXoshiro256StarStar >( ( uint64_t( rd() ) << 32 ) | rd() );
+}
+
 CGame::CGame()
 {
+    fRandom = defaultRandomEngine();
+
     fPlayInfo = std::make_shared< SPlayInfo >();
+    fPlayInfo->bindEvaluators();
 
     createDeck();
     resetGames();
 }
 
 
+std::unique_ptr< CGame > CGame::cloneConfiguration() const
+{
+    auto retVal = std::make_unique< CGame >();
+    for ( auto&& ii : fPlayers )
+        retVal->addPlayer( ii->name() );
+    retVal->fNumCardsToDeal = fNumCardsToDeal;
+    retVal->fNumBoardCards = fNumBoardCards;
+    retVal->fNumHoleCardsUsed = fNumHoleCardsUsed;
+    retVal->fRandom = fRandom->clone();
+
+    auto playInfo = retVal->fPlayInfo;
+    playInfo->fWildCards = fPlayInfo->fWildCards; // the cards are shared by every deck, see CCard::allCards
+    playInfo->fLowHandWins = fPlayInfo->fLowHandWins;
+    playInfo->fStraightsAndFlushesCount = fPlayInfo->fStraightsAndFlushesCount;
+    playInfo->fHiLoSplit = fPlayInfo->fHiLoSplit;
+    playInfo->fLowQualifier = fPlayInfo->fLowQualifier;
+    playInfo->bindEvaluators();
+    return retVal;
+}
+
+void CGame::setSeed( uint64_t seed )
+{
+    fRandom->seed( seed );
+    fShuffledCards = fCards;
+}
+
+void CGame::setRandomEngine( std::unique_ptr< CRandomEngine > engine )
+{
+    fRandom = engine ? std::move( engine ) : defaultRandomEngine();
+}
+
 void CGame::shuffleAndDeal()
 {
-    shuffleDeck();
+    shuffleDeck( *fRandom );
+    dealCards();
+}
+
+void CGame::shuffleAndDeal( uint64_t seed, uint64_t dealIndex )
+{
+    CCounterRandomEngine random( seed, dealIndex );
+    fShuffledCards = fCards;
+    autoSetDealer( random );
+    shuffleDeck( random );
     dealCards();
 }
 
@@ -53,14 +124,18 @@ CGame::~CGame()
 }
 
 void CGame::autoSetDealer()
+{
+    autoSetDealer( *fRandom );
+}
+
+void CGame::autoSetDealer( CRandomEngine & random )
 {
     if ( fPlayers.empty() )
          return;
-    std::random_device rd;
-    std::mt19937_64 gen( rd() );
-    std::uniform_int_distribution< size_t > dis( 0, fPlayers.size() - 1 );
-    auto newDealer = dis( gen );
+    auto newDealer = random.bounded( static_cast< uint32_t >( fPlayers.size() ) );
 
+    if ( !fDealer.expired() )
+        fDealer.lock()->setDealer( false );
     fDealer = fPlayers[ newDealer ];
     fDealer.lock()->setDealer( true );
 }
@@ -95,20 +170,37 @@ void CGame::prevDealer()
     }
 }
 
+SGameStats CGame::stats() const
+{
+    SGameStats retVal;
+    retVal.fNumDeals = fNumDeals;
+    retVal.fNumGames = fNumGames;
+    retVal.fLowWins = fLowWins;
+    retVal.fWinsByHand = fWinsByHand;
+    retVal.fHandCount = fHandCount;
+    retVal.fWinsByPlayer = fWinsByPlayer;
+    return retVal;
+}
+
 QString CGame::dumpStats() const
+{
+    return dumpStats( stats() );
+}
+
+QString CGame::dumpStats( const SGameStats & stats ) const
 {
     QLocale locale;
     QString retVal = 
-        QString( "Number of Games: %1\n" ).arg( locale.toString( static_cast< qulonglong >( fGames.size() ) ) ) +
+        QString( "Number of Games: %1\n" ).arg( locale.toString( static_cast< qulonglong >( stats.fNumGames ) ) ) +
         "=================================\n";
 
     retVal += QString( "Games Won by Player:\n" );
-    for ( size_t ii = 0; ii < fPlayers.size(); ++ii )
+    for ( size_t ii = 0; ( ii < fPlayers.size() ) && ( ii < stats.fWinsByPlayer.size() ); ++ii )
     {
         retVal += QString( "\t%1 - %2 (%3%)\n" )
             .arg( fPlayers[ ii ]->name() )
-            .arg( locale.toString( static_cast< qulonglong >( fWinsByPlayer[ static_cast<size_t>( ii ) ] ) ) )
-            .arg( locale.toString( ( 100.0 * fWinsByPlayer[ static_cast<size_t>( ii ) ] ) / fGames.size(), 'g', 3 ) );
+            .arg( locale.toString( static_cast< qulonglong >( stats.fWinsByPlayer[ static_cast<size_t>( ii ) ] ) ) )
+            .arg( locale.toString( ( 100.0 * stats.fWinsByPlayer[ static_cast<size_t>( ii ) ] ) / stats.fNumGames, 'g', 3 ) );
     }
     retVal += "=================================\n";
 
@@ -117,8 +209,14 @@ QString CGame::dumpStats() const
     {
         retVal += QString( "\t%1 - %2 (%3%)\n" )
             .arg( ::toString( ii, false ) )
-            .arg( locale.toString( static_cast< qulonglong >( fWinsByHand[ static_cast< size_t >( ii ) ] ) ) )
-            .arg( locale.toString( (100.0* fWinsByHand[ static_cast<size_t>( ii ) ] )/fGames.size(), 'g', 3 ) );
+            .arg( locale.toString( static_cast< qulonglong >( stats.fWinsByHand[ static_cast< size_t >( ii ) ] ) ) )
+            .arg( locale.toString( (100.0* stats.fWinsByHand[ static_cast<size_t>( ii ) ] )/stats.fNumGames, 'g', 3 ) );
+    }
+    if ( stats.fLowWins )
+    {
+        retVal += QString( "\tLow Half - %1 (%2%)\n" )
+            .arg( locale.toString( static_cast< qulonglong >( stats.fLowWins ) ) )
+            .arg( locale.toString( ( 100.0 * stats.fLowWins ) / stats.fNumGames, 'g', 3 ) );
     }
     retVal += "=================================\n";
 
@@ -127,8 +225,8 @@ QString CGame::dumpStats() const
     {
         retVal += QString( "\t%1 - %2 (%3%)\n" )
             .arg( ::toString( ii, false ) )
-            .arg( locale.toString( static_cast< qulonglong >( fHandCount[ static_cast<size_t>( ii ) ] ) ) )
-            .arg( locale.toString( ( 100.0 * fHandCount[ static_cast<size_t>( ii ) ] ) / fGames.size(), 'g', 3 ) );
+            .arg( locale.toString( static_cast< qulonglong >( stats.fHandCount[ static_cast<size_t>( ii ) ] ) ) )
+            .arg( locale.toString( ( 100.0 * stats.fHandCount[ static_cast<size_t>( ii ) ] ) / stats.fNumGames, 'g', 3 ) );
     }
 
     return retVal;
@@ -186,6 +284,13 @@ QString CGame::dumpGameDetails( bool /*details*/ ) const
         cards << ii->toString( false, false );
     }
     data += QString( "Wild Cards: %1\n" ).arg( cards.join( "," ) );
+    if ( !fBoardCards.empty() )
+    {
+        cards.clear();
+        for ( auto&& ii : fBoardCards )
+            cards << ii->toString( false, false );
+        data += QString( "Board: %1\n" ).arg( cards.join( " " ) );
+    }
     data += QString( "Sub 5 Card Poker Straights/Flushes Count: %1\n" ).arg( fPlayInfo->fStraightsAndFlushesCount ? "Yes" : "No" );
     data += QString( "Low Ball/Razz: %1\n" ).arg( fPlayInfo->fLowHandWins ? "Yes" : "No" );
     return data;
@@ -206,7 +311,9 @@ QString CGame::dumpPlayers( bool details ) const
 
 void CGame::resetGames()
 {
-    fGames.clear(); 
+    fNumGames = 0;
+    fNumDeals = 0;
+    fLowWins = 0;
     fHandCount.clear(); 
     fHandCount.resize( static_cast< size_t >( EHand::eFiveOfAKind ) + 1);
     fWinsByHand.clear();
@@ -215,17 +322,23 @@ void CGame::resetGames()
     fWinsByPlayer.resize( fPlayers.size() );
 }
 
-void CGame::shuffleDeck()
+void CGame::shuffleDeck( CRandomEngine & random )
 {
-    std::random_device rd;
-    std::mt19937_64 gen( rd() );
-    fShuffledCards = fCards;
-    std::shuffle( fShuffledCards.begin(), fShuffledCards.end(), gen );
-    std::shuffle( fShuffledCards.begin(), fShuffledCards.end(), gen );
-    std::shuffle( fShuffledCards.begin(), fShuffledCards.end(), gen );
-    std::shuffle( fShuffledCards.begin(), fShuffledCards.end(), gen );
-    std::shuffle( fShuffledCards.begin(), fShuffledCards.end(), gen );
-    std::shuffle( fShuffledCards.begin(), fShuffledCards.end(), gen );
+    // a partial Fisher-Yates, the front is a uniform draw from the whole deck whatever order the deck is in
+    if ( fShuffledCards.size() != fCards.size() )
+        fShuffledCards = fCards;
+    auto numCards = std::min( numCardsDealt(), fShuffledCards.size() );
+    auto deckSize = static_cast< uint32_t >( fShuffledCards.size() );
+    for ( uint32_t ii = 0; ii < numCards; ++ii )
+        std::swap( fShuffledCards[ ii ], fShuffledCards[ ii + random.bounded( deckSize - ii ) ] );
+}
+
+size_t CGame::numCardsDealt() const
+{
+    size_t retVal = fNumBoardCards;
+    for ( auto&& ii : fNumCardsToDeal )
+        retVal += ii * fPlayers.size();
+    return retVal;
 }
 
 void CGame::dealCards()
@@ -239,6 +352,7 @@ void CGame::dealCards()
     if ( fDealer.expired() )
         nextDealer();
 
+    fBoardCards.clear();
     auto currCard = fShuffledCards.begin();
 
     for( auto currDeal = fNumCardsToDeal.begin(); ( currCard != fShuffledCards.end() ) && ( currDeal != fNumCardsToDeal.end() ); ++currDeal  )
@@ -257,6 +371,11 @@ void CGame::dealCards()
         }
     }
 
+    for ( uint8_t ii = 0; ( ii < fNumBoardCards ) && ( currCard != fShuffledCards.end() ); ++ii, ++currCard )
+        fBoardCards.push_back( *currCard );
+    updateBoardContext();
+
+    fNumDeals++;
     analyzeHand( true );
 }
 
@@ -274,9 +393,27 @@ void CGame::analyzeHand( bool updateStats )
     if ( !updateStats )
         return;
 
+    logHandHistory( winners );
+
     for( auto && ii : fPlayers )
         fHandCount[ static_cast< size_t >( ii->hand() ) ]++;
 
+    if ( fPlayInfo->fHiLoSplit )
+    {
+        // each half is its own game, a scoop wins both
+        for ( auto && winner : fHiLoWinners.first )
+        {
+            fWinsByHand[ static_cast< size_t >( winner->hand() ) ]++;
+            fWinsByPlayer[ winner->playerID() ]++;
+        }
+        for ( auto && winner : fHiLoWinners.second )
+        {
+            fLowWins++;
+            fWinsByPlayer[ winner->playerID() ]++;
+        }
+        return;
+    }
+
     for( auto && winner : winners )
     {
         fWinsByHand[ static_cast<size_t>( winner->hand() ) ]++;
@@ -286,17 +423,66 @@ void CGame::analyzeHand( bool updateStats )
 
 void CGame::dumpPlayers( const std::string & header, const std::vector< std::shared_ptr< CPlayer > >  & players ) const
 {
-    std::cerr << "==============================" << "\n";
-    std::cerr << header << "\n";
-    std::cerr << "==============================" << "\n";
+    if ( !CLog::enabled( ELogLevel::eTrace ) )
+        return;
+
+    QString data = 
+        "==============================\n" +
+        QString::fromStdString( header ) + "\n" +
+        "==============================\n";
     for ( auto&& ii : players )
     {
-        std::cerr << "Player: " << qPrintable( ii->name() ) << " - " << qPrintable( ii->getHand()->toString() ) << "\n";
+        data += "Player: " + ii->name() + " - " + ii->getHand()->toString() + "\n";
     }
+    CLog::write( ELogLevel::eTrace, data );
+}
+
+// one line per deal, the board, each players cards and hand, then the winners
+void CGame::logHandHistory( const std::list< std::shared_ptr< CPlayer > > & winners ) const
+{
+    if ( !CLog::enabled( ELogLevel::eInfo ) )
+        return;
+
+    auto cardsToString = []( const std::vector< std::shared_ptr< CCard > > & cards )
+    {
+        QStringList retVal;
+        for ( auto&& ii : cards )
+            retVal << ii->toString( false, false );
+        return retVal.join( " " );
+    };
+
+    QString data = QString( "Deal %1:" ).arg( fNumDeals );
+    if ( !fBoardCards.empty() )
+        data += " Board [" + cardsToString( fBoardCards ) + "]";
+    for ( auto&& ii : fPlayers )
+        data += " " + ii->name() + " [" + cardsToString( ii->getHand()->getCards() ) + "] " + ii->getHand()->determineHandName( false ) + ";";
+    QStringList names;
+    for ( auto&& ii : winners )
+        names << ii->name();
+    data += " Winners: " + names.join( ", " ) + "\n";
+    CLog::write( ELogLevel::eInfo, data );
 }
 
 std::list< std::shared_ptr< CPlayer > > CGame::findWinners()
 {
+    if ( fPlayInfo->fHiLoSplit )
+    {
+        dumpPlayers( "Hi/Lo", fPlayers );
+        fHiLoWinners = findHiLoWinners();
+        std::list< std::shared_ptr< CPlayer > > winners;
+        for ( auto&& half : { fHiLoWinners.first, fHiLoWinners.second } )
+        {
+            for ( auto&& curr : half )
+            {
+                curr->setWinner( true );
+                fNumGames++;
+                if ( std::find( winners.begin(), winners.end(), curr ) == winners.end() )
+                    winners.push_back( curr );
+            }
+        }
+        return winners;
+    }
+
     auto currGame = fPlayers;
 
     dumpPlayers( "Pre Sort", currGame );
@@ -327,13 +513,44 @@ std::list< std::shared_ptr< CPlayer > > CGame::findWinners()
     for( auto && curr : winners )
     {
         curr->setWinner( true );
-        auto hand = curr->hand();
-        fGames.push_back( std::make_pair( hand, curr ) );
+        fNumGames++;
     }
 
     return winners;
 }
 
+std::pair< std::list< std::shared_ptr< CPlayer > >, std::list< std::shared_ptr< CPlayer > > > CGame::findHiLoWinners() const
+{
+    std::pair< std::list< std::shared_ptr< CPlayer > >, std::list< std::shared_ptr< CPlayer > > > retVal;
+    auto bestHigh = std::numeric_limits< uint32_t >::max();
+    auto bestLow = std::numeric_limits< uint32_t >::max();
+    for ( auto&& curr : fPlayers )
+    {
+        if ( !curr->hasCards() )
+            continue;
+
+        auto&& ranks = curr->getHand()->hiLoRanks();
+        if ( ranks.fHigh < bestHigh )
+        {
+            bestHigh = ranks.fHigh;
+            retVal.first.clear();
+        }
+        if ( ranks.fHigh == bestHigh )
+            retVal.first.push_back( curr );
+
+        if ( !ranks.hasLow() )
+            continue;
+        if ( ranks.fLow < bestLow )
+        {
+            bestLow = ranks.fLow;
+            retVal.second.clear();
+        }
+        if ( ranks.fLow == bestLow )
+            retVal.second.push_back( curr );
+    }
+    return retVal;
+}
+
 std::shared_ptr< CCard > CGame::getCard( const QString & cardName ) const
 {
     auto pos = fStringCardMap.find( cardName );
@@ -427,6 +644,7 @@ size_t CGame::setNumPlayers( size_t numPlayers )
     while( numPlayers > fPlayers.size() )
     {
         fPlayers.push_back( std::make_shared< CPlayer >( fPlayInfo ) );
+        fPlayers.back()->setBoard( fBoardContext );
     }
     while( numPlayers < fPlayers.size() )
         fPlayers.pop_back();
@@ -478,6 +696,33 @@ void CGame::recomputeNextPrev()
         fPlayers[ fPlayers.size() - 1 ]->setNextPlayer( fPlayers[ 0 ] );
 }
 
+void CGame::setNumHoleCardsUsed( std::optional< uint8_t > numHoleCards )
+{
+    fNumHoleCardsUsed = numHoleCards;
+    updateBoardContext();
+}
+
+void CGame::setBoard( const std::vector< std::shared_ptr< CCard > > & cards )
+{
+    fBoardCards = cards;
+    updateBoardContext();
+}
+
+void CGame::updateBoardContext()
+{
+    fBoardContext.reset();
+    if ( !fBoardCards.empty() )
+    {
+        std::optional< size_t > numHoleCards;
+        if ( fNumHoleCardsUsed.has_value() )
+            numHoleCards = fNumHoleCardsUsed.value();
+        fBoardContext = std::make_shared< const NHandUtils::CBoardContext >( fBoardCards, numHoleCards );
+    }
+
+    for ( auto&& ii : fPlayers )
+        ii->setBoard( fBoardContext );
+}
+
 void CGame::removePlayer( size_t playerNum )
 {
     if ( playerNum >= fPlayers.size() )
@@ -494,6 +739,7 @@ void CGame::removePlayer( size_t playerNum )
 void CGame::setStraightsAndFlushesCount( bool straightsAndFlushesCount )
 {
     fPlayInfo->fStraightsAndFlushesCount = straightsAndFlushesCount;
+    fPlayInfo->bindEvaluators();
 }
 
 bool CGame::straightsAndFlushesCount() const
@@ -504,6 +750,7 @@ bool CGame::straightsAndFlushesCount() const
 void CGame::setLowHandWins( bool lowHandWins )
 {
     fPlayInfo->fLowHandWins = lowHandWins;
+    fPlayInfo->bindEvaluators();
 }
 
 bool CGame::lowHandWins() const
@@ -511,17 +758,40 @@ bool CGame::lowHandWins() const
     return fPlayInfo->fLowHandWins;
 }
 
+void CGame::setHiLoSplit( bool hiLoSplit )
+{
+    fPlayInfo->fHiLoSplit = hiLoSplit;
+}
+
+bool CGame::hiLoSplit() const
+{
+    return fPlayInfo->fHiLoSplit;
+}
+
+void CGame::setLowQualifier( ECard qualifier )
+{
+    fPlayInfo->fLowQualifier = qualifier;
+}
+
+ECard CGame::lowQualifier() const
+{
+    return fPlayInfo->fLowQualifier;
+}
+
 void CGame::addWildCard( std::shared_ptr< CCard > card )
 {
     fPlayInfo->fWildCards.insert( card );
+    fPlayInfo->bindEvaluators();
 }
 
 void CGame::addWildCards( const std::vector< std::shared_ptr< CCard > > & cards )
 {
     fPlayInfo->fWildCards.insert( cards.begin(), cards.end() );
+    fPlayInfo->bindEvaluators();
 }
 
 void CGame::clearWildCards()
 {
     fPlayInfo->fWildCards.clear();
+    fPlayInfo->bindEvaluators();
 }
@@ -29,17 +29,36 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
+#include <optional>
 #include <QString>
 
 class CCard;
+class CRandomEngine;
 class CPlayer;
 struct SPlayInfo;
 enum class EHand;
 enum class ECard;
 enum class ESuit : uint8_t;
+namespace NHandUtils
+{
+    class CBoardContext;
+}
 
 using TCardDeal = std::vector< uint8_t >;
 
+// the counters of a run of deals, see CGame::stats and CSimulation
+struct SGameStats
+{
+    void add( const SGameStats & rhs );
+
+    uint64_t fNumDeals{ 0 };
+    uint64_t fNumGames{ 0 }; // one per winner, ties count each winner and a hi/lo split counts the winners of each half
+    uint64_t fLowWins{ 0 }; // winners of the low half of a hi/lo split, counted in fNumGames and fWinsByPlayer but not fWinsByHand
+    std::vector< uint64_t > fWinsByHand; // indexed by EHand, the high half only for a hi/lo split
+    std::vector< uint64_t > fHandCount; // indexed by EHand
+    std::vector< uint64_t > fWinsByPlayer; // indexed by player ID
+};
+
 class CGame 
 {
 public:
@@ -48,18 +67,31 @@ public:
 public:
     std::weak_ptr< CPlayer > currDealer() const{ return fDealer; }
     std::shared_ptr< SPlayInfo > playInfo() const { return fPlayInfo; }
+    std::unique_ptr< CGame > cloneConfiguration() const; // the players, deal and rules, not the cards dealt or the statistics
+    void setSeed( uint64_t seed ); // the same seed deals the same cards from a sorted deck, each game is seeded randomly when constructed
+    void setRandomEngine( std::unique_ptr< CRandomEngine > engine ); // used as is, nullptr restores the randomly seeded default
+    CRandomEngine & randomEngine() const { return *fRandom; }
 
     QString dumpGame( bool details ) const;
     void shuffleAndDeal();
+    void shuffleAndDeal( uint64_t seed, uint64_t dealIndex ); // deal dealIndex of the seed, the dealer and cards only depend on the seed, the index and the game configuration
     void nextDealer();
     void prevDealer();
     void autoSetDealer();
     void analyzeHand( bool updateStatistics );
-    std::list< std::shared_ptr< CPlayer > > findWinners(); // possible ties
+    std::list< std::shared_ptr< CPlayer > > findWinners(); // possible ties, both halves when the pot is split hi/lo
+    std::pair< std::list< std::shared_ptr< CPlayer > >, std::list< std::shared_ptr< CPlayer > > > findHiLoWinners() const; // high then low, possible ties, the low is empty when no hand qualifies
 
     void resetGames();
-    size_t numGames() const{ return fGames.size(); }
+    size_t numGames() const{ return fNumGames; }
+    uint64_t numDeals() const{ return fNumDeals; }
     QString dumpStats() const;
+    QString dumpStats( const SGameStats & stats ) const; // the players are named by this game
+    SGameStats stats() const;
+    const std::vector< uint64_t > & winsByHand() const{ return fWinsByHand; } // indexed by EHand
+    const std::vector< uint64_t > & handCount() const{ return fHandCount; } // indexed by EHand
+    const std::vector< uint64_t > & winsByPlayer() const{ return fWinsByPlayer; } // indexed by player ID
+    const std::vector< std::shared_ptr< CPlayer > > & players() const{ return fPlayers; }
     std::shared_ptr< CCard > getCard( const QString & cardName ) const;
     std::shared_ptr< CCard > getCard( ECard card, ESuit suit ) const;
     std::shared_ptr< CCard > getCard( const std::pair< ECard , ESuit > & card ) const;
@@ -69,6 +101,14 @@ public:
     void setNumCards( uint8_t numCards ){ fNumCardsToDeal = TCardDeal( { numCards } ); }
     TCardDeal cardDeal() const{ return fNumCardsToDeal; }
 
+    void setNumBoardCards( uint8_t numBoardCards ){ fNumBoardCards = numBoardCards; } // community cards, dealt after the players cards
+    uint8_t numBoardCards() const{ return fNumBoardCards; }
+    void setNumHoleCardsUsed( std::optional< uint8_t > numHoleCards ); // exactly this many of each players cards play with the board, omaha is 2, unset for any 5
+    std::optional< uint8_t > numHoleCardsUsed() const{ return fNumHoleCardsUsed; }
+    void setBoard( const std::vector< std::shared_ptr< CCard > > & cards );
+    const std::vector< std::shared_ptr< CCard > > & board() const{ return fBoardCards; }
+    std::shared_ptr< const NHandUtils::CBoardContext > boardContext() const{ return fBoardContext; } // nullptr when there is no board
+
     size_t setNumPlayers( size_t numPlayers );
     std::shared_ptr< CPlayer > addPlayer( const QString& name );
     std::pair< bool, std::shared_ptr< CPlayer > > setPlayerName( size_t playerNum, const QString & playerName );
@@ -81,16 +121,26 @@ public:
     void setLowHandWins( bool lowBall );
     bool lowHandWins() const;
 
+    void setHiLoSplit( bool hiLoSplit );
+    bool hiLoSplit() const;
+
+    void setLowQualifier( ECard qualifier );
+    ECard lowQualifier() const;
+
     void addWildCard( std::shared_ptr< CCard > card );
     void addWildCards( const std::vector< std::shared_ptr< CCard > > & cards );
     void clearWildCards();
 private:
-    void dumpPlayers( const std::string & header, const std::vector< std::shared_ptr< CPlayer > >& players ) const;
+    void dumpPlayers( const std::string & header, const std::vector< std::shared_ptr< CPlayer > >& players ) const; // at ELogLevel::eTrace
+    void logHandHistory( const std::list< std::shared_ptr< CPlayer > > & winners ) const; // at ELogLevel::eInfo
     void recomputeNextPrev();
+    void updateBoardContext();
     void createDeck();
 
-    void shuffleDeck();
+    void autoSetDealer( CRandomEngine & random );
+    void shuffleDeck( CRandomEngine & random ); // only the cards that will be dealt
     void dealCards();
+    size_t numCardsDealt() const;
 
     QString dumpDeck( bool shuffled ) const;
     QString dumpPlayers( bool details ) const;
@@ -99,18 +149,27 @@ private:
     std::vector< std::shared_ptr< CPlayer > > fPlayers;
     std::weak_ptr< CPlayer > fDealer;
     std::vector< std::shared_ptr< CCard > > fCards; // original and sorted
-    std::vector< std::shared_ptr< CCard > > fShuffledCards;
+    std::vector< std::shared_ptr< CCard > > fShuffledCards; // the front is shuffled each deal, the rest is left as the last deal left it
     std::unordered_map< QString, std::shared_ptr< CCard > > fStringCardMap;
     std::unordered_map< TCard, std::shared_ptr< CCard > > fCardMap;
 
-    std::vector< std::pair< EHand, std::weak_ptr< CPlayer > > > fGames;
+    uint64_t fNumGames{ 0 };
+    uint64_t fNumDeals{ 0 };
+    uint64_t fLowWins{ 0 };
     std::vector< uint64_t > fWinsByHand;
     std::vector< uint64_t > fHandCount;
     std::vector< uint64_t > fWinsByPlayer;
 
     TCardDeal fNumCardsToDeal{ 5 }; // first vector is player deals (first) then last is community, default is 5 card 
+    uint8_t fNumBoardCards{ 0 };
+    std::optional< uint8_t > fNumHoleCardsUsed;
+    std::vector< std::shared_ptr< CCard > > fBoardCards;
+    std::shared_ptr< const NHandUtils::CBoardContext > fBoardContext; // computed once per deal and shared by every player
+
+    std::pair< std::list< std::shared_ptr< CPlayer > >, std::list< std::shared_ptr< CPlayer > > > fHiLoWinners; // the halves of the last findWinners of a hi/lo split
 
     std::shared_ptr< SPlayInfo > fPlayInfo;
+    std::unique_ptr< CRandomEngine > fRandom;
 };
 
 #endif 
@@ -31,12 +31,14 @@
 #include "Evaluate5CardHand.h"
 
 #include <map>
+#include <array>
 #include <set>
 #include <optional>
 #include <iostream>
 #include <algorithm>
 #include <unordered_map>
 #include <fstream>
+#include <iterator>
 
 namespace NHandUtils
 {
@@ -45,9 +47,9 @@ namespace NHandUtils
         return std::string( 4 * sz, ' ' );
     }
 
-    static std::string getWhichItemEnum( bool straightsAndFlushesCount, bool lowBall )
+    static std::string getWhichItemName( bool straightsAndFlushesCount, bool lowBall )
     {
-        std::string retVal = "SCardInfoData::EWhichItem::eStraightsAndFlushes";
+        std::string retVal = "StraightsAndFlushes";
 
         if ( straightsAndFlushesCount && !lowBall )
             retVal += "Count";
@@ -82,19 +84,49 @@ namespace NHandUtils
             << "#include \"PlayInfo.h\"\n"
             << "#include \"Hand.h\"\n"
             << "\n"
-            << "#include <map>\n"
-            << "\n"
             << "//#define __USECARDMAPS\n"
             << "\n"
             << "namespace NHandUtils\n"
             << "{\n"
-            << getPadding( 1 ) << "SCardInfoData " << getClassName( size ) << "::sCardInfoData = {};\n"
+            << getPadding( 1 ) << "namespace\n"
+            << getPadding( 1 ) << "{\n"
+            ;
+    }
+
+    // the tables are constant arrays, sCardInfoData is an aggregate of views on them so nothing is built at runtime
+    static void generateCardInfoData( std::ostream& oss, size_t size )
+    {
+        auto tableName = []( const std::string & suffix, bool straightsAndFlushesCount, bool lowBall )
+        {
+            return "makeTable( s" + getWhichItemName( straightsAndFlushesCount, lowBall ) + suffix + " )";
+        };
+        auto tableNames = [ tableName ]( const std::string & suffix )
+        {
+            // ordered by SCardInfoData::EWhichItem
+            return "{ " + tableName( suffix, false, true ) + ", " + tableName( suffix, true, true ) + ", " + tableName( suffix, false, false ) + ", " + tableName( suffix, true, false ) + " }";
+        };
+
+        oss << getPadding( 1 ) << "}\n"
+            << "\n"
+            << getPadding( 1 ) << "SCardInfoData " << getClassName( size ) << "::sCardInfoData =\n"
+            << getPadding( 1 ) << "{\n"
+            << getPadding( 2 ) << " makeTable( sFlushes )\n"
+            << getPadding( 2 ) << "," << tableNames( "Unique" ) << "\n"
+            << getPadding( 2 ) << ",{ makeTable( sProductDisplacements ), makeTable( sProductEntries ) }\n"
+            << getPadding( 2 ) << "," << tableNames( "Hands" ) << "\n"
+            << "#ifdef __USECARDMAPS\n"
+            << getPadding( 2 ) << "," << tableNames( "CardMap" ) << "\n"
+            << "#else\n"
+            << getPadding( 2 ) << ",{}\n"
+            << "#endif\n"
+            << getPadding( 2 ) << ",false // fAllHandsComputed\n"
+            << getPadding( 2 ) << ",true // fTablesInitialized\n"
+            << getPadding( 1 ) << "};\n"
             << "\n"
             << getPadding( 1 ) << "void " << getClassName( size ) << "::initMaps()\n"
             << getPadding( 1 ) << "{\n"
-            << getPadding( 2 )     << "if ( !sCardInfoData.fTablesInitialized )\n"
-            << getPadding( 2 )     << "{\n"
-            << getPadding( 3 )         << "sCardInfoData.fTablesInitialized = true;\n"
+            << getPadding( 1 ) << "}\n"
+            << "\n"
             ;
     }
 
@@ -144,9 +176,9 @@ namespace NHandUtils
 
         using NHandUtils::getPadding;
         oss
-            << getPadding( 3 ) << "// " << comment << "\n"
-            << getPadding( 3 ) << "sCardInfoData.fCardMaps[ " << getWhichItemEnum( straightsAndFlushesCount, lowBall ) << " ] =\n"
-            << getPadding( 3 ) << "{\n"
+            << getPadding( 2 ) << "// " << comment << "\n"
+            << getPadding( 2 ) << "constexpr SCardMapEntry s" << getWhichItemName( straightsAndFlushesCount, lowBall ) << "CardMap[] =\n"
+            << getPadding( 2 ) << "{\n"
             ;
 
         sabDebugStream() << "Writing Map: " << map.size() << "\n";
@@ -157,7 +189,7 @@ namespace NHandUtils
             if ( ( ( *ii ).second % updateOn ) == 0 )
                 sabDebugStream() << "   Computing Hand Value: Hand #" << ( *ii ).second << " of " << map.size() << "\n";
 
-            oss << getPadding( 4 );
+            oss << getPadding( 3 );
             if ( first )
                 oss << " ";
             else
@@ -187,7 +219,7 @@ namespace NHandUtils
             prevHandType = currHandType;
         }
         sabDebugStream() << "Finished Writing Map: " << map.size() << "\n";
-        oss << getPadding( 3 ) << "};\n\n";
+        oss << getPadding( 2 ) << "};\n\n";
         oss.flush();
     }
 
@@ -203,89 +235,73 @@ namespace NHandUtils
         computeAndGenerateMap( oss, straightsAndFlushesDontCountLowBall, false, true );
         computeAndGenerateMap( oss, straightsAndFlushesCountLowBall, true, true );
 
-        oss << "#else\n"
-            << getPadding( 3 ) << "sCardInfoData.fCardMaps = { {}, {}, {}, {} };\n"
-            << "#endif\n"
+        oss << "#endif\n"
             << "\n"
             ;
     }
 
+    // dense hand type per rank, laid out for lookupHandType
+    // each rank takes the hand type with the largest minimum rank at or below it
+    // the first 13 entries are the ranks below the wild card offset, five of a kind for 5 cards, then rank 0 which is unused
     template< typename T >
-    void CCardInfo::generateITE( std::ostream& oss, size_t size, const T& map, bool straightsAndFlushesCount, bool lowBall ) const
+    static std::vector< EHand > computeHandsByRank( size_t size, const T& map, bool straightsAndFlushesCount, bool lowBall )
     {
         std::map< EHand, uint32_t > handTypeToMinRank;
+        uint32_t maxRank = 0;
         for ( auto&& ii : map )
         {
             auto handType = ii.first->getHandType( straightsAndFlushesCount, lowBall );
             auto pos = handTypeToMinRank.find( handType );
-            auto minValue = ii.second;
-
-            if ( ( pos == handTypeToMinRank.end() ) || ( minValue < (*pos).second ) )
-                handTypeToMinRank[ handType ] = minValue;
+            if ( ( pos == handTypeToMinRank.end() ) || ( ii.second < ( *pos ).second ) )
+                handTypeToMinRank[ handType ] = ii.second;
+            maxRank = std::max( maxRank, ii.second );
         }
 
         std::map< uint32_t, EHand > minRankToHandType;
         for ( auto&& ii : handTypeToMinRank )
-        {
             minRankToHandType[ ii.second ] = ii.first;
-        }
-        std::string wildCardSuffix;
-        if ( size == 5 )
-            wildCardSuffix = " + ( playInfo->hasWildCards() ? 13 : 0 )";
 
-        bool first = true;
-        for ( auto ii = minRankToHandType.rbegin(); ii != minRankToHandType.rend(); ++ii )
+        std::vector< EHand > retVal( 13 + maxRank + 1 );
+        auto lowestRankHand = ( *minRankToHandType.begin() ).second;
+        for ( uint32_t ii = 0; ii < retVal.size(); ++ii )
         {
-            oss << getPadding( 3 );
-            if ( !first )
-                oss << "else ";
-            first = false;
-
-            bool isOne = ( ( *ii ).first == 1 );
-            if ( isOne )
-                oss << "/* ";
-            oss << "if ( rank >= " << ( *ii ).first << "U" << wildCardSuffix << " )";
-            if ( isOne )
-                oss << " */";
-            oss << "\n"
-                << getPadding( 4 ) << "hand = " << toCPPString( ( *ii ).second ) << ";\n";
+            if ( ii < 13 )
+                retVal[ ii ] = ( size == 5 ) ? EHand::eFiveOfAKind : lowestRankHand;
+            else if ( ii == 13 )
+                retVal[ ii ] = lowestRankHand;
+            else
+                retVal[ ii ] = ( *std::prev( minRankToHandType.upper_bound( ii - 13 ) ) ).second;
         }
+        return retVal;
     }
 
-    template< typename T1, typename T2, typename T3, typename T4 >
-    void CCardInfo::generateRankFunction( std::ostream& oss, size_t size, const T1& straightsAndFlushesDontCount, const T2& straightsAndFlushesCount, const T3& straightsAndFlushesDontCountLowBall, const T4& straightsAndFlushesCountLowBall ) const
+    static void generateRankFunction( std::ostream& oss, size_t size )
     {
-        oss << getPadding( 1 ) << "EHand C" << size << "CardInfo::rankToCardHand( uint32_t rank, const std::shared_ptr< SPlayInfo > & playInfo )\n"
+        oss << getPadding( 1 ) << "EHand " << getClassName( size ) << "::rankToCardHand( uint32_t rank, const std::shared_ptr< SPlayInfo > & playInfo )\n"
             << getPadding( 1 ) << "{\n"
-            << getPadding( 2 ) << "EHand hand;\n"
-            << getPadding( 2 ) << "if ( !playInfo->fStraightsAndFlushesCount && !playInfo->fLowHandWins )\n"
-            << getPadding( 2 ) << "{\n";
-        generateITE( oss, size, straightsAndFlushesDontCount, false, false );
-        oss << getPadding( 2 ) << "}\n"
-            << getPadding( 2 ) << "else if ( !playInfo->fStraightsAndFlushesCount && playInfo->fLowHandWins )\n"
-            << getPadding( 2 ) << "{\n";
-        generateITE( oss, size, straightsAndFlushesDontCountLowBall, false, true );
-        oss << getPadding( 2 ) << "}\n"
-            << getPadding( 2 ) << "else if ( playInfo->fStraightsAndFlushesCount && !playInfo->fLowHandWins )\n"
-            << getPadding( 2 ) << "{\n";
-        generateITE( oss, size, straightsAndFlushesCount, true, false );
-        oss << getPadding( 2 ) << "}\n"
-            << getPadding( 2 ) << "else /* if ( playInfo->fStraightsAndFlushesCount && playInfo->fLowHandWins ) */\n"
-            << getPadding( 2 ) << "{\n";
-        generateITE( oss, size, straightsAndFlushesCountLowBall, true, true );
-        oss << getPadding( 2 ) << "}\n"
-            << getPadding( 2 ) << "return hand;\n"
+            << getPadding( 2 ) << "return sCardInfoData.rankToCardHand( rank, playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins, playInfo->hasWildCards() );\n"
             << getPadding( 1 ) << "}\n"
             ;
         oss.flush();
     }
 
-    static void generateTable( std::ostream& oss, const std::vector< uint32_t >& values, const std::string& varName )
+    static std::string toTableValue( uint32_t value )
+    {
+        return std::to_string( value );
+    }
+
+    static std::string toTableValue( EHand value )
+    {
+        return toCPPString( value );
+    }
+
+    template< typename T >
+    static void generateTable( std::ostream& oss, const std::vector< T >& values, const std::string& typeName, const std::string& varName )
     {
-        size_t indent = 3;
+        size_t indent = 2;
         oss
-            << getPadding( indent ) << "sCardInfoData."
-            << varName << " =\n"
+            << getPadding( indent ) << "constexpr " << typeName << " "
+            << varName << "[] =\n"
             << getPadding( indent )
             ;
 
@@ -298,7 +314,7 @@ namespace NHandUtils
             if ( numChars == 0 )
                 oss << getPadding( indent + 1 );
 
-            auto tmp = std::to_string( values[ ii ] );
+            auto tmp = toTableValue( values[ ii ] );
             oss << tmp;
             numChars += tmp.size();
             bool lastValue = ( ii == ( values.size() - 1 ) );
@@ -323,30 +339,29 @@ namespace NHandUtils
         oss.flush();
     }
 
-    static void generateMap( std::ostream& oss, const std::map< uint64_t, uint16_t >& values, const std::string & varName )
+    static void generateProductIndex( std::ostream& oss, const std::vector< uint32_t > & displacements, const std::vector< SProductIndex::SEntry > & entries )
     {
-        size_t indent = 3;
-        oss
-            << getPadding( indent ) << "sCardInfoData."
-            << varName << " =\n"
-            << getPadding( indent )
-            ;
+        size_t indent = 2;
+        oss << getPadding( indent ) << "// Paired hands, minimal perfect hash of the hand product, ranks are indexed by SCardInfoData::EWhichItem\n";
+        generateTable( oss, displacements, "uint32_t", "sProductDisplacements" );
 
-        oss << "{\n"
+        oss
+            << getPadding( indent ) << "constexpr SProductIndex::SEntry sProductEntries[] =\n"
+            << getPadding( indent ) << "{\n"
             ;
         bool first = true;
-        for ( auto&& ii : values )
+        for ( auto&& ii : entries )
         {
-            oss << getPadding( indent + 1 ) ;
+            oss << getPadding( indent + 1 );
 
             if ( !first )
                 oss << ",";
             else
                 oss << " ";
             first = false;
-            oss << "{ " << ii.first << ", " << ii.second << " }\n";
+            oss << "{ " << ii.fProduct << ", { " << ii.fRanks[ 0 ] << ", " << ii.fRanks[ 1 ] << ", " << ii.fRanks[ 2 ] << ", " << ii.fRanks[ 3 ] << " } }\n";
         }
-        oss << getPadding( indent ) << "};\n\n";
+        oss << getPadding( indent ) << "};\n";
         oss.flush();
     }
 
@@ -374,9 +389,16 @@ namespace NHandUtils
             wildCardSuffix = " + ( playInfo->hasWildCards() ? 13 : 0 )";
         oss << getPadding( 1 ) << "uint32_t C" << size << "CardInfo::evaluateCardHand( const std::vector< std::shared_ptr< CCard > > & cards, const std::shared_ptr< SPlayInfo > & playInfo )\n"
             << getPadding( 1 ) << "{\n"
-            << getPadding( 2 )     << "initMaps();\n"
             << getPadding( 2 )     << "return sCardInfoData.evaluateCardHand( cards, playInfo, " << size << " );\n"
             << getPadding( 1 ) << "}\n\n";
+        oss << getPadding( 1 ) << "uint32_t C" << size << "CardInfo::evaluateCardHand( SCardSpan cards, const std::shared_ptr< SPlayInfo > & playInfo )\n"
+            << getPadding( 1 ) << "{\n"
+            << getPadding( 2 )     << "return sCardInfoData.evaluateCardHand( cards, playInfo, " << size << " );\n"
+            << getPadding( 1 ) << "}\n\n";
+        oss << getPadding( 1 ) << "void C" << size << "CardInfo::evaluateCardHands( SCardSpan cards, const std::shared_ptr< SPlayInfo > & playInfo, uint32_t * ranks )\n"
+            << getPadding( 1 ) << "{\n"
+            << getPadding( 2 )     << "sCardInfoData.evaluateCardHands( cards, playInfo, " << size << ", ranks );\n"
+            << getPadding( 1 ) << "}\n\n";
     }
 
     template< typename T >
@@ -452,8 +474,7 @@ namespace NHandUtils
             for( auto && ii : uniqueValueVectors )
                 ii.resize( maxCardsValue + 1 );
 
-            std::vector< std::map< uint64_t, uint16_t > > productMaps;
-            productMaps.resize( 4 );
+            std::map< uint64_t, std::array< uint16_t, 4 > > productRanks;
 
             for ( auto&& ii : allHands )
             {
@@ -477,30 +498,37 @@ namespace NHandUtils
                 }
                 else
                 {
-                    auto productValue = ii.second->handProduct();
-                    productMaps[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCount ][ productValue ] = straightsAndFlushesDontCountValue;
-                    productMaps[ SCardInfoData::EWhichItem::eStraightsAndFlushesCount ][ productValue ] = straightsAndFlushesCountValue;
-                    productMaps[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCountLowBall ][ productValue ] = straightsAndFlushesDontCountLowBallValue;
-                    productMaps[ SCardInfoData::EWhichItem::eStraightsAndFlushesCountLowBall ][ productValue ] = straightsAndFlushesCountLowBallValue;
+                    auto && ranks = productRanks[ ii.second->handProduct() ];
+                    ranks[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCount ] = straightsAndFlushesDontCountValue;
+                    ranks[ SCardInfoData::EWhichItem::eStraightsAndFlushesCount ] = straightsAndFlushesCountValue;
+                    ranks[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCountLowBall ] = straightsAndFlushesDontCountLowBallValue;
+                    ranks[ SCardInfoData::EWhichItem::eStraightsAndFlushesCountLowBall ] = straightsAndFlushesCountLowBallValue;
                 }
             }
 
             std::string className = getClassName( getNumCards() );
-            generateTable( oss, flushes, "fFlushes" );
+            generateTable( oss, flushes, "uint32_t", "sFlushes" );
+
+            generateTable( oss, uniqueValueVectors[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCount ], "uint32_t", "s" + getWhichItemName( false, false ) + "Unique" );
+            generateTable( oss, uniqueValueVectors[ SCardInfoData::EWhichItem::eStraightsAndFlushesCount ], "uint32_t", "s" + getWhichItemName( true, false ) + "Unique" );
+            generateTable( oss, uniqueValueVectors[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCountLowBall ], "uint32_t", "s" + getWhichItemName( false, true ) + "Unique" );
+            generateTable( oss, uniqueValueVectors[ SCardInfoData::EWhichItem::eStraightsAndFlushesCountLowBall ], "uint32_t", "s" + getWhichItemName( true, true ) + "Unique" );
+
+            std::vector< uint32_t > productDisplacements;
+            std::vector< SProductIndex::SEntry > productEntries;
+            SProductIndex::build( productRanks, productDisplacements, productEntries );
+            generateProductIndex( oss, productDisplacements, productEntries );
 
-            generateTable( oss, uniqueValueVectors[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCount ], "fUniqueVectors[ " + getWhichItemEnum( false, false ) + " ]" );
-            generateTable( oss, uniqueValueVectors[ SCardInfoData::EWhichItem::eStraightsAndFlushesCount ], "fUniqueVectors[ " + getWhichItemEnum( true, false ) + " ]" );
-            generateTable( oss, uniqueValueVectors[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCountLowBall ], "fUniqueVectors[ " + getWhichItemEnum( false, true ) + " ]" );
-            generateTable( oss, uniqueValueVectors[ SCardInfoData::EWhichItem::eStraightsAndFlushesCountLowBall ], "fUniqueVectors[ " + getWhichItemEnum( true, true ) + " ]" );
+            oss << getPadding( 2 ) << "// hand type by rank, see lookupHandType\n";
+            generateTable( oss, computeHandsByRank( getNumCards(), straightsAndFlushesDontCount, false, false ), "EHand", "s" + getWhichItemName( false, false ) + "Hands" );
+            generateTable( oss, computeHandsByRank( getNumCards(), straightsAndFlushesCount, true, false ), "EHand", "s" + getWhichItemName( true, false ) + "Hands" );
+            generateTable( oss, computeHandsByRank( getNumCards(), straightsAndFlushesDontCountLowBall, false, true ), "EHand", "s" + getWhichItemName( false, true ) + "Hands" );
+            generateTable( oss, computeHandsByRank( getNumCards(), straightsAndFlushesCountLowBall, true, true ), "EHand", "s" + getWhichItemName( true, true ) + "Hands" );
 
-            generateMap( oss, productMaps[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCount ], "fProductMaps[ " + getWhichItemEnum( false, false ) + " ]" );
-            generateMap( oss, productMaps[ SCardInfoData::EWhichItem::eStraightsAndFlushesCount ], "fProductMaps[ " + getWhichItemEnum( true, false ) + " ]" );
-            generateMap( oss, productMaps[ SCardInfoData::EWhichItem::eStraightsAndFlushesDontCountLowBall ], "fProductMaps[ " + getWhichItemEnum( false, true ) + " ]" );
-            generateMap( oss, productMaps[ SCardInfoData::EWhichItem::eStraightsAndFlushesCountLowBall ], "fProductMaps[ " + getWhichItemEnum( true, true ) + " ]" );
-            oss << getPadding( 2 ) << "}\n" << getPadding( 1 ) << "}\n\n";
+            generateCardInfoData( oss, getNumCards() );
 
             generateEvaluateFunction( oss, getNumCards() );
-            generateRankFunction( oss, getNumCards(), straightsAndFlushesDontCount, straightsAndFlushesCount, straightsAndFlushesDontCountLowBall, straightsAndFlushesCountLowBall );
+            generateRankFunction( oss, getNumCards() );
             generateFooter( oss );
         }
     }
@@ -119,11 +119,21 @@ const std::optional< std::pair< uint32_t, std::unique_ptr< CHand > > > & CHand::
     return fHandImpl->bestHand();
 }
 
+const NHandUtils::SHiLoRanks & CHand::hiLoRanks() const
+{
+    return fHandImpl->hiLoRanks();
+}
+
 bool CHand::hasCards() const
 {
     return fHandImpl->hasCards();
 }
 
+void CHand::setBoard( const std::shared_ptr< const NHandUtils::CBoardContext > & board )
+{
+    fHandImpl->setBoard( board );
+}
+
 void CHand::resetHandAnalysis()
 {
     fHandImpl->resetHandAnalysis();
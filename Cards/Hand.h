@@ -57,6 +57,11 @@ std::ostream& operator<<( std::ostream& oss, EHand value );
 enum class ECard;
 class CCard;
 class CHandImpl;
+namespace NHandUtils
+{
+    struct SHiLoRanks;
+    class CBoardContext;
+}
 struct SPlayInfo;
 class CHand
 {
@@ -74,6 +79,7 @@ public:
     void setStraightsAndFlushesCount( bool straightsAndFlushesCount );
     void setLowHandWins( bool lowHandWins );
     void addWildCard( std::shared_ptr< CCard > card ); // needed for unit testing
+    void setBoard( const std::shared_ptr< const NHandUtils::CBoardContext > & board ); // the community cards played with these, nullptr for none
     EHand computeHand() const;
     EHand getHand() const;
 
@@ -88,6 +94,7 @@ public:
     const std::vector< std::shared_ptr< CCard > > & getCards() const;
 
     const std::optional< std::pair< uint32_t, std::unique_ptr< CHand > > >& bestHand() const;
+    const NHandUtils::SHiLoRanks & hiLoRanks() const; // both halves of a hi/lo split, lower is better for each
     bool hasCards() const;
     void resetHandAnalysis();
 
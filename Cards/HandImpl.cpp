@@ -21,6 +21,7 @@
 // SOFTWARE.
 
 #include "HandImpl.h"
+#include "BoardContext.h"
 #include "Card.h"
 #include "Hand.h"
 #include "PlayInfo.h"
@@ -42,7 +43,10 @@ void CHandImpl::resetHandAnalysis()
     fAndValue.reset();
     fOrValue.reset();
     fHandProduct.reset();
+    fBestCards.reset();
     fBestHand.reset();
+    fHandType.reset();
+    fHiLoRanks.reset();
 }
 
 void CHandImpl::clearCards()
@@ -65,6 +69,16 @@ void CHandImpl::addCard( std::shared_ptr< CCard > card )
 void CHandImpl::addWildCard( std::shared_ptr< CCard > card )
 {
     fPlayInfo->fWildCards.insert( card );
+    if ( fPlayInfo->evaluatorsBound() )
+        fPlayInfo->bindEvaluators();
+    resetHandAnalysis();
+}
+
+void CHandImpl::setBoard( const std::shared_ptr< const NHandUtils::CBoardContext > & board )
+{
+    if ( fBoard == board )
+        return;
+    fBoard = board;
     resetHandAnalysis();
 }
 
@@ -80,13 +94,32 @@ QString CHandImpl::toString() const
         retVal += ii->toString( false, false );
     }
 
-    if ( fBestHand.has_value() )
+    if ( fBestCards.has_value() )
     {
-        retVal += " - Best Hand: " + fBestHand.value().second->toString() + " - " + determineHandName( true );
+        retVal += " - Best Hand: " + bestHand().value().second->toString() + " - " + determineHandName( true );
     }
     return retVal;
 }
 
+const std::optional< std::pair< uint32_t, std::unique_ptr< CHand > > >& CHandImpl::bestHand() const
+{
+    if ( fBestCards.has_value() && !fBestHand.has_value() )
+        fBestHand = fBestCards.value().toHand( fPlayInfo );
+    return fBestHand;
+}
+
+const NHandUtils::SHiLoRanks & CHandImpl::hiLoRanks() const
+{
+    if ( !fHiLoRanks.has_value() )
+    {
+        if ( fBoard )
+            fHiLoRanks = fBoard->hiLoRanks( fCards, fPlayInfo );
+        else
+            fHiLoRanks = NHandUtils::evaluateHiLo( fCards, fPlayInfo );
+    }
+    return fHiLoRanks.value();
+}
+
 QString CHandImpl::determineHandName( bool details ) const
 {
     if ( details )
@@ -114,7 +147,7 @@ std::tuple< EHand, std::vector< ECard >, std::vector< ECard > > CHandImpl::deter
         return emptyHand;
 
     auto hand = computeHand();
-    if ( !fBestHand.has_value() )
+    if ( !fBestCards.has_value() )
         return emptyHand;
 
     std::vector< ECard > cards;
@@ -126,8 +159,8 @@ std::tuple< EHand, std::vector< ECard >, std::vector< ECard > > CHandImpl::deter
         case EHand::eFlush:
         case EHand::eStraight:
             {
-                cards = std::vector< ECard >( { NHandUtils::getMaxCard( fBestHand.value().second->getCards() ) } );
-                for( auto && ii : fBestHand.value().second->getCards() )
+                cards = std::vector< ECard >( { NHandUtils::getMaxCard( fBestCards.value().cards( fPlayInfo ) ) } );
+                for( auto && ii : fBestCards.value().cards( fPlayInfo ) )
                 {
                     if ( ii->getCard() == cards[ 0 ] )
                         continue;
@@ -144,7 +177,7 @@ std::tuple< EHand, std::vector< ECard >, std::vector< ECard > > CHandImpl::deter
         case EHand::eHighCard:
             {
                 std::map< ECard, uint8_t > cardHits;
-                for ( auto && card : fBestHand.value().second->getCards() )
+                for ( auto && card : fBestCards.value().cards( fPlayInfo ) )
                     cardHits[ card->getCard() ]++;
 
                 for ( auto&& ii : cardHits )
@@ -177,7 +210,9 @@ EHand CHandImpl::computeHand() const
     if ( fCards.empty() )
         return EHand::eNoCards;
     auto rank = evaluateHand();
-    return NHandUtils::rankToHand( rank, fCards.size(), fPlayInfo );
+    if ( fHandType.has_value() )
+        return fHandType.value();
+    return NHandUtils::rankToHand( rank, fCards.size() + ( fBoard ? fBoard->size() : 0 ), fPlayInfo );
 }
 
 EHand CHandImpl::getHand() const
@@ -189,17 +224,18 @@ EHand CHandImpl::getHand() const
 
 uint32_t CHandImpl::evaluateHand() const
 {
-    if ( !fBestHand.has_value() )
+    if ( !fBestCards.has_value() )
     {
-        fBestHand = NHandUtils::evaluateHand( fCards, fPlayInfo );
-        if ( !fBestHand->second )
+        fBestCards = fBoard ? fBoard->findBestHand( fCards, fPlayInfo ) : NHandUtils::evaluateBestHand( fCards, fPlayInfo );
+        if ( !fBestCards->hasHand() )
         {
-            fBestHand.reset();
+            fBestCards.reset();
             return -1;
         }
+        fHandType = NHandUtils::rankToHand( fBestCards->fRank, fCards.size() + ( fBoard ? fBoard->size() : 0 ), fPlayInfo );
     }
 
-    return fBestHand.value().first;
+    return fBestCards.value().fRank;
 }
 
 bool CHandImpl::isFlush() const
@@ -35,6 +35,10 @@ enum class ECard;
 enum class EHand;
 class CCard;
 struct SPlayInfo;
+namespace NHandUtils
+{
+    class CBoardContext;
+}
 
 class CHandImpl
 {
@@ -50,6 +54,7 @@ public:
     bool hasCards() const{ return !fCards.empty(); }
 
     void addWildCard( std::shared_ptr< CCard > card );
+    void setBoard( const std::shared_ptr< const NHandUtils::CBoardContext > & board );
 
     QString toString() const;
     QString determineHandName( bool details ) const;
@@ -57,7 +62,8 @@ public:
     EHand computeHand() const;
     EHand getHand() const;
     const std::vector< std::shared_ptr< CCard > > & getCards() const{ return fCards; }
-    const std::optional< std::pair< uint32_t, std::unique_ptr< CHand > > >& bestHand() const{ return fBestHand; }
+    const std::optional< std::pair< uint32_t, std::unique_ptr< CHand > > >& bestHand() const;
+    const NHandUtils::SHiLoRanks & hiLoRanks() const;
 
     uint32_t evaluateHand() const;
 
@@ -66,6 +72,7 @@ public:
 private:
     std::vector< std::shared_ptr< CCard > > fCards;
     std::shared_ptr< SPlayInfo > fPlayInfo;
+    std::shared_ptr< const NHandUtils::CBoardContext > fBoard; // shared by every player at the table
 
     // these values get cached for speed, but are called via const functions, hence the mutable nature
     mutable std::optional< std::tuple< EHand, std::vector< ECard >, std::vector< ECard > > > fHand;
@@ -75,7 +82,10 @@ private:
     mutable std::optional< NHandUtils::TCardBitType > fAndValue;
     mutable std::optional< NHandUtils::TCardBitType > fOrValue;
     mutable std::optional< uint64_t > fHandProduct;
-    mutable std::optional< std::pair< uint32_t, std::unique_ptr< CHand > > > fBestHand; // tanks into account wildcard
+    mutable std::optional< NHandUtils::SBestHand > fBestCards; // tanks into account wildcard
+    mutable std::optional< std::pair< uint32_t, std::unique_ptr< CHand > > > fBestHand; // built from fBestCards when asked for
+    mutable std::optional< EHand > fHandType; // categorized with fBestCards, so computeHand is a cached read
+    mutable std::optional< NHandUtils::SHiLoRanks > fHiLoRanks;
 };
 
 #endif 
@@ -27,49 +27,1031 @@
 #include "Evaluate3CardHand.h"
 #include "Evaluate4CardHand.h"
 #include "Evaluate5CardHand.h"
+#include "Evaluate6CardHand.h"
+#include "Evaluate7CardHand.h"
 #include "PlayInfo.h"
+#include "WildCardCache.h"
 
 #include "SABUtils/utils.h"
 #include <iostream>
+#include <atomic>
 #include <set>
 #include <unordered_map>
 
 namespace NHandUtils
 {
     uint32_t evaluateHandInternal( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo > & playInfo );
+    uint32_t evaluateHandInternal( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo );
 
-    std::pair< uint32_t, std::unique_ptr< CHand > > findBest( const std::vector< std::vector< std::shared_ptr< CCard > > >& allHands, const std::shared_ptr< SPlayInfo >& playInfo )
+    static std::vector< std::shared_ptr< CCard > > cardsFromMask( const std::vector< std::shared_ptr< CCard > >& cards, uint32_t mask )
+    {
+        std::vector< std::shared_ptr< CCard > > retVal;
+        for ( size_t ii = 0; ii < cards.size(); ++ii )
+        {
+            if ( mask & ( 1U << ii ) )
+                retVal.push_back( cards[ ii ] );
+        }
+        return retVal;
+    }
+
+    const std::vector< std::shared_ptr< CCard > >& SBestHand::cards( const std::shared_ptr< SPlayInfo >& playInfo ) const
+    {
+        if ( fCards.empty() && !fCandidates.empty() )
+        {
+            TPackedHand< 7 > packedCards;
+            toPackedCards( fCandidates, packedCards.data(), packedCards.size() );
+            fCards = cardsFromMask( fCandidates, findCombination( SCardSpan( packedCards.data(), fCandidates.size() ), 5, fRank, playInfo ) );
+            fCandidates.clear();
+        }
+        return fCards;
+    }
+
+    std::pair< uint32_t, std::unique_ptr< CHand > > SBestHand::toHand( const std::shared_ptr< SPlayInfo >& playInfo ) const
     {
-        auto best = std::make_pair( std::numeric_limits< uint32_t >::max(), std::unique_ptr< CHand >() );
+        if ( cards( playInfo ).empty() )
+            return std::make_pair( fRank, std::unique_ptr< CHand >() );
+        return std::make_pair( fRank, std::make_unique< CHand >( fCards, fSharesPlayInfo ? playInfo : nullptr ) );
+    }
+
+    SBestHand findBestHand( const std::vector< std::vector< std::shared_ptr< CCard > > >& allHands, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        SBestHand best;
+        const std::vector< std::shared_ptr< CCard > > * bestCards = nullptr;
         for ( size_t ii = 0; ii < allHands.size(); ++ii )
         {
             auto&& currHand = allHands[ ii ];
             if ( currHand.size() > 5 )
             {
-                auto bestFive = findBest( currHand, 5, playInfo );
-                if ( bestFive.first < best.first )
+                auto bestFive = findBestHand( currHand, 5, playInfo );
+                if ( bestFive.fRank < best.fRank )
                 {
-                    best.first = bestFive.first;
-                    best.second.swap( bestFive.second );
+                    best = std::move( bestFive );
+                    bestCards = nullptr;
                 }
             }
             else
             {
                 auto currHandValue = evaluateHandInternal( currHand, playInfo );
-                if ( currHandValue < best.first )
+                if ( currHandValue < best.fRank )
                 {
-                    best.first = currHandValue;
-                    best.second = std::make_unique< CHand >( currHand, nullptr );
+                    best.fRank = currHandValue;
+                    bestCards = &currHand;
                 }
             }
         }
+        if ( bestCards )
+            best.fCards = *bestCards;
         return best;
     }
 
-    std::pair< uint32_t, std::unique_ptr< CHand > > findBest( const std::vector< std::shared_ptr< CCard > >& cards, int numCards, const std::shared_ptr< SPlayInfo > & playInfo )
+    SBestHand findBestHand( const std::vector< std::shared_ptr< CCard > >& cards, int numCards, const std::shared_ptr< SPlayInfo > & playInfo )
     {
+        if ( ( ( cards.size() == 6 ) || ( cards.size() == 7 ) ) && ( numCards == 5 ) )
+        {
+            // rank the 6 or 7 cards directly, the 5 cards are only found if the hand is asked for
+            TPackedHand< 7 > packedCards;
+            toPackedCards( cards, packedCards.data(), packedCards.size() );
+            auto packedSpan = SCardSpan( packedCards.data(), cards.size() );
+            auto evaluator = playInfo->evaluator( cards.size() );
+            auto rank = evaluator ? ( *evaluator )( packedSpan ) : evaluateHand( packedSpan, playInfo );
+            if ( rank != kNoRank )
+            {
+                SBestHand retVal;
+                retVal.fRank = rank;
+                retVal.fCandidates = cards;
+                return retVal;
+            }
+        }
+
+        // stream the combinations through the packed evaluator, only the best hand is materialized
+        std::array< TPackedCard, 32 > packedCards;
+        if ( ( numCards <= 5 ) && toPackedCards( cards, packedCards.data(), packedCards.size() ) )
+        {
+            auto best = findBest( SCardSpan( packedCards.data(), cards.size() ), numCards, playInfo );
+            if ( best.second == 0 )
+                return SBestHand();
+            return { best.first, cardsFromMask( cards, best.second ) };
+        }
+
         auto allCombinations = NUtils::allCombinations( cards, numCards );
-        return findBest( allCombinations, playInfo );
+        return findBestHand( allCombinations, playInfo );
+    }
+
+    std::pair< uint32_t, std::unique_ptr< CHand > > findBest( const std::vector< std::vector< std::shared_ptr< CCard > > >& allHands, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        return findBestHand( allHands, playInfo ).toHand( playInfo );
+    }
+
+    std::pair< uint32_t, std::unique_ptr< CHand > > findBest( const std::vector< std::shared_ptr< CCard > >& cards, int numCards, const std::shared_ptr< SPlayInfo > & playInfo )
+    {
+        return findBestHand( cards, numCards, playInfo ).toHand( playInfo );
+    }
+
+    // calls func( hand, mask ) for each numCards combination of cards, stops when func returns false
+    // walks the mask of the cards left out with Gosper's hack, bit ii of the mask standing for cards[ size - 1 - ii ]
+    // so the combinations come in the same lexicographic order as NUtils::allCombinations and ties resolve to the same cards
+    template< typename T >
+    static void forEachCombination( SCardSpan cards, size_t numCards, T func )
+    {
+        if ( ( numCards == 0 ) || ( numCards > 5 ) || ( numCards > cards.size() ) || ( cards.size() > 32 ) )
+            return;
+
+        auto numAllCards = cards.size();
+        auto allCardsMask = ( uint64_t( 1 ) << numAllCards ) - 1;
+        auto leftOut = ( uint64_t( 1 ) << ( numAllCards - numCards ) ) - 1;
+
+        TPackedHand< 5 > currHand;
+        while ( true )
+        {
+            uint32_t currMask = 0;
+            size_t pos = 0;
+            for ( size_t ii = 0; ii < numAllCards; ++ii )
+            {
+                if ( leftOut & ( uint64_t( 1 ) << ( numAllCards - 1 - ii ) ) )
+                    continue;
+                currHand[ pos++ ] = cards[ ii ];
+                currMask |= 1U << ii;
+            }
+
+            if ( !func( SCardSpan( currHand.data(), numCards ), currMask ) )
+                return;
+
+            if ( leftOut == 0 )
+                break;
+
+            // next larger mask with the same number of bits set
+            auto lowestBit = leftOut & ( ~leftOut + 1 );
+            auto ripple = leftOut + lowestBit;
+            leftOut = ( ( ( ripple ^ leftOut ) >> 2 ) / lowestBit ) | ripple;
+            if ( leftOut > allCardsMask )
+                break;
+        }
+    }
+
+    // the 5 card combinations of numAllCards in revolving door order, each mask differs from the one before by one card out and one card in
+    // R( n, k ) is R( n - 1, k ) followed by R( n - 1, k - 1 ) reversed with card n - 1 added
+    static std::vector< uint32_t > revolvingDoorMasks( size_t numAllCards, size_t numCards )
+    {
+        if ( numCards == 0 )
+            return { 0 };
+        if ( numCards == numAllCards )
+            return { ( 1U << numAllCards ) - 1 };
+
+        auto retVal = revolvingDoorMasks( numAllCards - 1, numCards );
+        auto withLast = revolvingDoorMasks( numAllCards - 1, numCards - 1 );
+        for ( auto ii = withLast.rbegin(); ii != withLast.rend(); ++ii )
+            retVal.push_back( *ii | ( 1U << ( numAllCards - 1 ) ) );
+        return retVal;
+    }
+
+    struct SRevolvingDoor
+    {
+        uint32_t fFirst{ 0 };
+        std::vector< std::pair< uint8_t, uint8_t > > fSteps; // the index of the card out and the card in for each following combination
+    };
+
+    static size_t lowestBitIndex( uint32_t mask )
+    {
+        size_t retVal = 0;
+        while ( mask && !( mask & 1 ) )
+        {
+            mask >>= 1;
+            retVal++;
+        }
+        return retVal;
+    }
+
+    static const SRevolvingDoor & revolvingDoor( size_t numAllCards )
+    {
+        static const auto sDoors = []()
+        {
+            std::array< SRevolvingDoor, 11 > retVal;
+            for ( size_t ii = 5; ii < retVal.size(); ++ii )
+            {
+                auto masks = revolvingDoorMasks( ii, 5 );
+                retVal[ ii ].fFirst = masks.front();
+                for ( size_t jj = 1; jj < masks.size(); ++jj )
+                {
+                    auto diff = masks[ jj - 1 ] ^ masks[ jj ];
+                    retVal[ ii ].fSteps.emplace_back( static_cast< uint8_t >( lowestBitIndex( diff & masks[ jj - 1 ] ) ), static_cast< uint8_t >( lowestBitIndex( diff & masks[ jj ] ) ) );
+                }
+            }
+            return retVal;
+        }();
+        return sDoors[ numAllCards ];
+    }
+
+    // true when mask comes before rhs in the lexicographic order of forEachCombination
+    static bool comesFirst( uint32_t mask, uint32_t rhs )
+    {
+        auto diff = mask ^ rhs;
+        return ( mask & diff & ( ~diff + 1 ) ) != 0;
+    }
+
+    // the rank counts, suit counts, rank bits and prime product of a 5 card combination, updated one card at a time
+    struct SCombinationState
+    {
+        void addCard( TPackedCard card )
+        {
+            auto rank = ( card >> 8 ) & 0x0F;
+            if ( ( rank < fRankCounts.size() ) && ( fRankCounts[ rank ]++ == 0 ) )
+            {
+                fCardsValue |= static_cast< uint16_t >( card >> 16 );
+                fNumDistinct++;
+            }
+            fSuitCounts[ ( card >> 12 ) & 0x0F ]++;
+            fProduct *= ( card & 0x00FF );
+        }
+        void removeCard( TPackedCard card )
+        {
+            auto rank = ( card >> 8 ) & 0x0F;
+            if ( ( rank < fRankCounts.size() ) && ( --fRankCounts[ rank ] == 0 ) )
+            {
+                fCardsValue &= ~static_cast< uint16_t >( card >> 16 );
+                fNumDistinct--;
+            }
+            fSuitCounts[ ( card >> 12 ) & 0x0F ]--;
+            fProduct /= ( card & 0x00FF );
+        }
+        bool isFlush() const
+        {
+            return ( fSuitCounts[ 1 ] == 5 ) || ( fSuitCounts[ 2 ] == 5 ) || ( fSuitCounts[ 4 ] == 5 ) || ( fSuitCounts[ 8 ] == 5 );
+        }
+
+        std::array< uint8_t, 13 > fRankCounts = { 0 }; // indexed by the rank value
+        std::array< uint8_t, 16 > fSuitCounts = { 0 }; // indexed by the one hot suit bits
+        uint16_t fCardsValue{ 0 };
+        size_t fNumDistinct{ 0 };
+        uint64_t fProduct{ 1 };
+    };
+
+    // calls func( state, mask ) for each 5 card combination of 5 to 10 cards in revolving door order
+    template< typename T >
+    static void forEachRevolvingDoorCombination( SCardSpan cards, T func )
+    {
+        auto&& door = revolvingDoor( cards.size() );
+        SCombinationState state;
+        auto currMask = door.fFirst;
+        for ( size_t ii = 0; ii < cards.size(); ++ii )
+        {
+            if ( currMask & ( 1U << ii ) )
+                state.addCard( cards[ ii ] );
+        }
+
+        for ( size_t ii = 0; ; ++ii )
+        {
+            func( static_cast< const SCombinationState & >( state ), currMask );
+            if ( ii == door.fSteps.size() )
+                break;
+
+            auto&& step = door.fSteps[ ii ];
+            state.removeCard( cards[ step.first ] );
+            state.addCard( cards[ step.second ] );
+            currMask ^= ( 1U << step.first ) | ( 1U << step.second );
+        }
+    }
+
+    static std::atomic< uint64_t > sFindBestSearches{ 0 };
+    static std::atomic< uint64_t > sFindBestCombinations{ 0 };
+    static std::atomic< uint64_t > sFindBestEvaluated{ 0 };
+    static std::atomic< uint64_t > sFindBestPruned{ 0 };
+    static std::atomic< uint64_t > sFindBestShortCircuits{ 0 };
+
+    SFindBestStats findBestStats()
+    {
+        SFindBestStats retVal;
+        retVal.fSearches = sFindBestSearches.load( std::memory_order_relaxed );
+        retVal.fCombinations = sFindBestCombinations.load( std::memory_order_relaxed );
+        retVal.fEvaluated = sFindBestEvaluated.load( std::memory_order_relaxed );
+        retVal.fPruned = sFindBestPruned.load( std::memory_order_relaxed );
+        retVal.fShortCircuits = sFindBestShortCircuits.load( std::memory_order_relaxed );
+        return retVal;
+    }
+
+    void resetFindBestStats()
+    {
+        sFindBestSearches.store( 0, std::memory_order_relaxed );
+        sFindBestCombinations.store( 0, std::memory_order_relaxed );
+        sFindBestEvaluated.store( 0, std::memory_order_relaxed );
+        sFindBestPruned.store( 0, std::memory_order_relaxed );
+        sFindBestShortCircuits.store( 0, std::memory_order_relaxed );
+    }
+
+    // the best 5 card rank that is not a flush for each number of distinct ranks, indexed by EWhichItem then the number of distinct ranks
+    // without wild cards, -1 when no hand has that many distinct ranks
+    static const std::array< std::array< uint32_t, 6 >, 4 > & bestRankByDistinctRanks()
+    {
+        static const auto sBounds = []()
+        {
+            std::array< std::array< uint32_t, 6 >, 4 > retVal;
+            for ( auto&& ii : retVal )
+                ii.fill( -1 );
+
+            auto&& cardInfoData = C5CardInfo::cardInfoData();
+            for ( auto&& straightsAndFlushesCount : { false, true } )
+            {
+                for ( auto&& lowHandWins : { false, true } )
+                {
+                    auto&& bounds = retVal[ SCardInfoData::toWhichItem( straightsAndFlushesCount, lowHandWins ) ];
+                    auto numRanks = C5CardInfo::handsByRank( straightsAndFlushesCount, lowHandWins ).size() - 13;
+                    for ( uint32_t rank = 1; rank <= numRanks; ++rank )
+                    {
+                        size_t numDistinct = 0;
+                        switch ( cardInfoData.rankToCardHand( rank, straightsAndFlushesCount, lowHandWins, false ) )
+                        {
+                            case EHand::eHighCard:
+                            case EHand::eStraight:
+                                numDistinct = 5;
+                                break;
+                            case EHand::ePair:
+                                numDistinct = 4;
+                                break;
+                            case EHand::eTwoPair:
+                            case EHand::eThreeOfAKind:
+                                numDistinct = 3;
+                                break;
+                            case EHand::eFullHouse:
+                            case EHand::eFourOfAKind:
+                                numDistinct = 2;
+                                break;
+                            default:
+                                continue;
+                        }
+                        bounds[ numDistinct ] = std::min( bounds[ numDistinct ], rank );
+                    }
+                }
+            }
+            return retVal;
+        }();
+        return sBounds;
+    }
+
+    // high hands that cant make a flush are won by the best four of a kind, or failing that the best full house, so they are built directly
+    // returns the mask of the first such combination in forEachCombination order, 0 when the cards have neither
+    static uint32_t bestQuadsOrFullHouse( SCardSpan cards, const std::array< uint8_t, 13 > & rankCounts )
+    {
+        auto highest = [ &rankCounts ]( size_t minCount, size_t skip )
+        {
+            for ( auto ii = rankCounts.size(); ii > 0; --ii )
+            {
+                if ( ( ( ii - 1 ) != skip ) && ( rankCounts[ ii - 1 ] >= minCount ) )
+                    return ii - 1;
+            }
+            return rankCounts.size();
+        };
+        // the first numCards cards of rank, the lowest indexes come first
+        auto cardsOfRank = [ &cards ]( size_t rank, size_t numCards )
+        {
+            uint32_t retVal = 0;
+            for ( size_t ii = 0; ( ii < cards.size() ) && numCards; ++ii )
+            {
+                if ( ( ( cards[ ii ] >> 8 ) & 0x0F ) == rank )
+                {
+                    retVal |= 1U << ii;
+                    numCards--;
+                }
+            }
+            return retVal;
+        };
+
+        auto made = highest( 4, rankCounts.size() );
+        auto kicker = highest( 1, made );
+        auto numKickers = 1;
+        if ( made == rankCounts.size() )
+        {
+            made = highest( 3, rankCounts.size() );
+            kicker = highest( 2, made );
+            numKickers = 2;
+        }
+        if ( ( made == rankCounts.size() ) || ( kicker == rankCounts.size() ) )
+            return 0;
+        return cardsOfRank( made, 5 - numKickers ) | cardsOfRank( kicker, numKickers );
+    }
+
+    // best 5 of 6 to 10 cards, the rank counts, suit counts and prime product are updated by the one card that changes between combinations
+    // rather than recomputing the OR, AND and product of all 5 cards, ties resolve to the same cards as forEachCombination
+    // pruned by what the whole hand can make, flushes are only looked for when a suit has 5 cards
+    // and combinations are skipped when no hand with as many distinct ranks can beat the best so far
+    static std::pair< uint32_t, uint32_t > findBestFive( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        auto&& door = revolvingDoor( cards.size() );
+        auto&& cardInfoData = C5CardInfo::cardInfoData();
+        auto straightsAndFlushesCount = playInfo->fStraightsAndFlushesCount;
+        auto lowHandWins = playInfo->fLowHandWins;
+        auto wildCards = playInfo->hasWildCards();
+        uint32_t wildCardOffset = wildCards ? 13 : 0;
+
+        std::array< uint8_t, 13 > rankCounts = { 0 }; // indexed by the rank value
+        std::array< uint8_t, 16 > suitCounts = { 0 }; // indexed by the one hot suit bits
+        bool validRanks = true;
+        for ( auto&& ii : cards )
+        {
+            auto rank = ( ii >> 8 ) & 0x0F;
+            if ( rank < rankCounts.size() )
+                validRanks = ( ++rankCounts[ rank ] <= 4 ) && validRanks;
+            else
+                validRanks = false;
+            suitCounts[ ( ii >> 12 ) & 0x0F ]++;
+        }
+        auto flushPossible = straightsAndFlushesCount && ( ( suitCounts[ 1 ] >= 5 ) || ( suitCounts[ 2 ] >= 5 ) || ( suitCounts[ 4 ] >= 5 ) || ( suitCounts[ 8 ] >= 5 ) );
+        sFindBestSearches.fetch_add( 1, std::memory_order_relaxed );
+        sFindBestCombinations.fetch_add( door.fSteps.size() + 1, std::memory_order_relaxed );
+
+        if ( validRanks && !lowHandWins && !flushPossible )
+        {
+            if ( auto mask = bestQuadsOrFullHouse( cards, rankCounts ) )
+            {
+                TPackedHand< 5 > bestHand;
+                size_t pos = 0;
+                for ( size_t ii = 0; ii < cards.size(); ++ii )
+                {
+                    if ( mask & ( 1U << ii ) )
+                        bestHand[ pos++ ] = cards[ ii ];
+                }
+                sFindBestEvaluated.fetch_add( 1, std::memory_order_relaxed );
+                sFindBestPruned.fetch_add( door.fSteps.size(), std::memory_order_relaxed );
+                sFindBestShortCircuits.fetch_add( 1, std::memory_order_relaxed );
+                return std::make_pair( evaluateHandInternal( bestHand, playInfo ), mask );
+            }
+        }
+
+        auto&& distinctBounds = bestRankByDistinctRanks()[ SCardInfoData::toWhichItem( straightsAndFlushesCount, lowHandWins ) ];
+        auto best = std::make_pair( std::numeric_limits< uint32_t >::max(), 0U );
+        uint64_t numPruned = 0;
+        forEachRevolvingDoorCombination( cards,
+            [ & ]( const SCombinationState & state, uint32_t currMask )
+            {
+                auto flush = flushPossible && state.isFlush();
+                if ( !flush && validRanks && ( distinctBounds[ state.fNumDistinct ] != kNoRank ) && ( best.first != kNoRank ) && ( distinctBounds[ state.fNumDistinct ] + wildCardOffset > best.first ) )
+                {
+                    numPruned++;
+                    return;
+                }
+
+                auto currHandValue = cardInfoData.evaluateCardHand( state.fCardsValue, state.fProduct, flush, straightsAndFlushesCount, lowHandWins, wildCards );
+                if ( ( currHandValue < best.first ) || ( ( currHandValue == best.first ) && ( currHandValue != kNoRank ) && comesFirst( currMask, best.second ) ) )
+                    best = std::make_pair( currHandValue, currMask );
+            } );
+        sFindBestEvaluated.fetch_add( door.fSteps.size() + 1 - numPruned, std::memory_order_relaxed );
+        sFindBestPruned.fetch_add( numPruned, std::memory_order_relaxed );
+        return best;
+    }
+
+    std::pair< uint32_t, uint32_t > findBest( SCardSpan cards, size_t numCards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        if ( ( numCards == 5 ) && ( cards.size() >= 6 ) && ( cards.size() <= 10 ) && !gUseLegacyFindBest.load( std::memory_order_relaxed ) )
+            return findBestFive( cards, playInfo );
+
+        auto best = std::make_pair( std::numeric_limits< uint32_t >::max(), 0U );
+        forEachCombination( cards, numCards,
+            [ &best, &playInfo ]( SCardSpan currHand, uint32_t currMask )
+            {
+                auto currHandValue = evaluateHandInternal( currHand, playInfo );
+                if ( currHandValue < best.first )
+                    best = std::make_pair( currHandValue, currMask );
+                return true;
+            } );
+        return best;
+    }
+
+    uint32_t findCombination( SCardSpan cards, size_t numCards, uint32_t rank, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        uint32_t retVal = 0;
+        forEachCombination( cards, numCards,
+            [ &retVal, rank, &playInfo ]( SCardSpan currHand, uint32_t currMask )
+            {
+                if ( evaluateHandInternal( currHand, playInfo ) != rank )
+                    return true;
+                retVal = currMask;
+                return false;
+            } );
+        return retVal;
+    }
+
+    std::vector< SPartialHand > partialHands( SCardSpan cards, size_t numCards )
+    {
+        if ( numCards == 0 )
+            return { SPartialHand() };
+
+        std::vector< SPartialHand > retVal;
+        forEachCombination( cards, numCards,
+            [ &retVal ]( SCardSpan currHand, uint32_t currMask )
+            {
+                SPartialHand partial;
+                for ( auto&& ii : currHand )
+                    partial.addCard( ii );
+                partial.fMask = currMask;
+                retVal.push_back( partial );
+                return true;
+            } );
+        return retVal;
+    }
+
+    SHoleAndBoardBest findBestHoleAndBoard( SCardSpan holeCards, size_t numHoleCards, const std::vector< SPartialHand > & board, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        SHoleAndBoardBest retVal;
+        if ( board.empty() || ( numHoleCards > 5 ) || ( std::bitset< 32 >( board.front().fMask ).count() + numHoleCards != 5 ) )
+            return retVal;
+
+        auto&& cardInfoData = C5CardInfo::cardInfoData();
+        auto straightsAndFlushesCount = playInfo->fStraightsAndFlushesCount;
+        auto lowHandWins = playInfo->fLowHandWins;
+        auto wildCards = playInfo->hasWildCards();
+        for ( auto&& hole : partialHands( holeCards, numHoleCards ) )
+        {
+            for ( auto&& ii : board )
+            {
+                auto flush = ( hole.fSuits & ii.fSuits ) != 0;
+                auto rank = cardInfoData.evaluateCardHand( hole.fRanks | ii.fRanks, hole.fProduct * ii.fProduct, flush, straightsAndFlushesCount, lowHandWins, wildCards );
+                if ( rank < retVal.fRank )
+                    retVal = { rank, hole.fMask, ii.fMask };
+            }
+        }
+        return retVal;
+    }
+
+    SBestHand findBestHoleAndBoard( const std::vector< std::shared_ptr< CCard > >& holeCards, size_t numHoleCards, const std::vector< std::shared_ptr< CCard > >& board, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        if ( ( numHoleCards > 5 ) || ( numHoleCards > holeCards.size() ) || ( 5 - numHoleCards > board.size() ) )
+            return SBestHand();
+
+        if ( playInfo->hasWildCards() )
+        {
+            // the wild cards are substituted hand by hand
+            std::vector< std::vector< std::shared_ptr< CCard > > > allHands;
+            auto boardCombinations = NUtils::allCombinations( board, 5 - numHoleCards );
+            for ( auto&& hole : NUtils::allCombinations( holeCards, numHoleCards ) )
+            {
+                for ( auto&& ii : boardCombinations )
+                {
+                    allHands.push_back( hole );
+                    allHands.back().insert( allHands.back().end(), ii.begin(), ii.end() );
+                }
+            }
+            return findBestHand( allHands, playInfo );
+        }
+
+        std::array< TPackedCard, 32 > packedHole;
+        std::array< TPackedCard, 32 > packedBoard;
+        if ( !toPackedCards( holeCards, packedHole.data(), packedHole.size() ) || !toPackedCards( board, packedBoard.data(), packedBoard.size() ) )
+            return SBestHand();
+
+        auto best = findBestHoleAndBoard( SCardSpan( packedHole.data(), holeCards.size() ), numHoleCards, partialHands( SCardSpan( packedBoard.data(), board.size() ), 5 - numHoleCards ), playInfo );
+        if ( best.fRank == kNoRank )
+            return SBestHand();
+
+        auto cards = cardsFromMask( holeCards, best.fHoleMask );
+        auto boardCards = cardsFromMask( board, best.fBoardMask );
+        cards.insert( cards.end(), boardCards.begin(), boardCards.end() );
+        return { best.fRank, cards };
+    }
+
+    // the rank bits a qualifying low may hold, the ace always plays low
+    static uint16_t lowQualifierMask( ECard qualifier )
+    {
+        if ( ( qualifier == ECard::eUNKNOWN ) || ( qualifier >= ECard::eKing ) )
+            return 0x1FFF;
+        return static_cast< uint16_t >( ( ( 2U << static_cast< uint32_t >( qualifier ) ) - 1 ) | ( 1U << static_cast< uint32_t >( ECard::eAce ) ) );
+    }
+
+    // 5 distinct aces low ranks compare highest card first, the numeric order of the rank bits with the ace moved below the deuce
+    // so the lows are ranked by counting the 5 bit masks in order, 1 is the wheel
+    // the low ball tables keep the generateAllCardHands order, the ace is compared before the other cards so every low holding
+    // an ace is ranked apart from the lows without one, the two orders only agree within each group, see HandUtils.HiLoLowMatchesLowBallTables
+    static uint32_t lowRank( uint16_t ranks, size_t numDistinct, uint16_t lowMask )
+    {
+        static const auto sLowRanks = []()
+        {
+            std::vector< uint16_t > retVal( 1 << 13, 0 );
+            uint16_t rank = 0;
+            for ( size_t ii = 0; ii < retVal.size(); ++ii )
+            {
+                if ( std::bitset< 13 >( ii ).count() == 5 )
+                    retVal[ ii ] = ++rank;
+            }
+            return retVal;
+        }();
+
+        if ( ( numDistinct != 5 ) || ( ranks & ~lowMask ) )
+            return -1;
+        return sLowRanks[ ( ( ranks & 0x0FFF ) << 1 ) | ( ranks >> 12 ) ];
+    }
+
+    static uint32_t lowRank( const SCombinationState & state, uint16_t lowMask )
+    {
+        return lowRank( static_cast< uint16_t >( state.fCardsValue ), state.fNumDistinct, lowMask );
+    }
+
+    static SHiLoRanks evaluateHiLo( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo, bool computeHigh )
+    {
+        SHiLoRanks retVal;
+        if ( cards.size() < 5 )
+        {
+            if ( computeHigh )
+                retVal.fHigh = evaluateHand( cards, playInfo );
+            return retVal;
+        }
+
+        auto&& cardInfoData = C5CardInfo::cardInfoData();
+        auto straightsAndFlushesCount = playInfo->fStraightsAndFlushesCount;
+        auto lowHandWins = playInfo->fLowHandWins;
+        auto wildCards = playInfo->hasWildCards();
+        auto lowMask = lowQualifierMask( playInfo->fLowQualifier );
+        auto evaluate = [ & ]( const SCombinationState & state )
+        {
+            if ( computeHigh )
+            {
+                auto flush = straightsAndFlushesCount && state.isFlush();
+                retVal.fHigh = std::min( retVal.fHigh, cardInfoData.evaluateCardHand( state.fCardsValue, state.fProduct, flush, straightsAndFlushesCount, lowHandWins, wildCards ) );
+            }
+            retVal.fLow = std::min( retVal.fLow, lowRank( state, lowMask ) );
+        };
+
+        if ( cards.size() <= 10 )
+        {
+            forEachRevolvingDoorCombination( cards, [ &evaluate ]( const SCombinationState & state, uint32_t /*currMask*/ ) { evaluate( state ); } );
+        }
+        else
+        {
+            forEachCombination( cards, 5,
+                [ &evaluate ]( SCardSpan currHand, uint32_t /*currMask*/ )
+                {
+                    SCombinationState state;
+                    for ( auto&& ii : currHand )
+                        state.addCard( ii );
+                    evaluate( state );
+                    return true;
+                } );
+        }
+        return retVal;
+    }
+
+    SHiLoRanks evaluateHiLo( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        return evaluateHiLo( cards, playInfo, true );
+    }
+
+    SHiLoRanks evaluateHiLo( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        std::array< TPackedCard, 32 > packedCards;
+        if ( !toPackedCards( cards, packedCards.data(), packedCards.size() ) )
+            return SHiLoRanks();
+
+        auto packedSpan = SCardSpan( packedCards.data(), cards.size() );
+        if ( !playInfo->hasWildCards() )
+            return evaluateHiLo( packedSpan, playInfo, true );
+
+        auto retVal = evaluateHiLo( packedSpan, playInfo, false );
+        retVal.fHigh = evaluateBestHand( cards, playInfo ).fRank;
+        return retVal;
+    }
+
+    uint32_t findBestLow( SCardSpan holeCards, size_t numHoleCards, const std::vector< SPartialHand > & board, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        uint32_t retVal = kNoRank;
+        if ( board.empty() || ( numHoleCards > 5 ) || ( std::bitset< 32 >( board.front().fMask ).count() + numHoleCards != 5 ) )
+            return retVal;
+
+        // 5 cards with 5 rank bits between them are 5 distinct ranks
+        auto lowMask = lowQualifierMask( playInfo->fLowQualifier );
+        for ( auto&& hole : partialHands( holeCards, numHoleCards ) )
+        {
+            if ( hole.fRanks & ~lowMask )
+                continue;
+            for ( auto&& ii : board )
+            {
+                auto ranks = static_cast< uint16_t >( hole.fRanks | ii.fRanks );
+                retVal = std::min( retVal, lowRank( ranks, std::bitset< 13 >( ranks ).count(), lowMask ) );
+            }
+        }
+        return retVal;
+    }
+
+    // substitutes for the wild cards are chosen by rank, suits only matter for flushes
+    // so the state is the rank counts, product and suits of the hand plus the suits each substitute could take
+    struct SWildCardHand
+    {
+        std::array< uint8_t, 13 > fCounts{}; // indexed by the rank value
+        std::array< uint8_t, 13 > fSubstitutes{}; // indexed by the rank value
+        uint64_t fProduct{ 1 };
+        uint16_t fRanks{ 0 };
+        uint8_t fSuits{ 0 }; // suits of the dealt cards in the hand
+        uint8_t fAnySuits{ 0 }; // suits any substitute could take
+        uint8_t fCommonSuits{ 0x0F }; // suits every substitute could take
+        bool fPaired{ false };
+    };
+
+    static size_t numSuits( uint8_t suits )
+    {
+        return std::bitset< 4 >( suits ).count();
+    }
+
+    class CWildCardSolver
+    {
+    public:
+        CWildCardSolver( const std::vector< TPackedCard >& fixed, size_t numCards, const std::shared_ptr< SPlayInfo >& playInfo ) :
+            fFixed( fixed ),
+            fNumCards( numCards ),
+            fHandSize( std::min< size_t >( numCards, 5 ) ),
+            fPlayInfo( playInfo )
+        {
+            switch ( fHandSize )
+            {
+                case 2: fCardInfoData = &C2CardInfo::cardInfoData(); break;
+                case 3: fCardInfoData = &C3CardInfo::cardInfoData(); break;
+                case 4: fCardInfoData = &C4CardInfo::cardInfoData(); break;
+                case 5: fCardInfoData = &C5CardInfo::cardInfoData(); break;
+                default: break;
+            }
+        }
+
+        // best rank reachable with numWild more cards that are not in fixed, hands over 5 cards take the best 5
+        // stops as soon as a rank at or below target is found
+        uint32_t bestRank( size_t numWild, uint32_t target = 0 )
+        {
+            fBest = -1;
+            fTarget = target;
+            if ( !fCardInfoData )
+                return fBest;
+
+            fAvailableSuits.fill( 0x0F );
+            for ( auto&& ii : fFixed )
+                fAvailableSuits[ ( ii >> 8 ) & 0x0F ] &= ~static_cast< uint8_t >( ( ii >> 12 ) & 0x0F );
+
+            // every card is in the hand unless there are more than 5
+            auto minSubstitutes = ( fNumCards <= 5 ) ? numWild : ( ( fHandSize > fFixed.size() ) ? fHandSize - fFixed.size() : 0 );
+            auto maxSubstitutes = ( fNumCards <= 5 ) ? numWild : std::min( numWild, fHandSize );
+            for ( auto numSubstitutes = minSubstitutes; numSubstitutes <= maxSubstitutes; ++numSubstitutes )
+            {
+                auto numDealt = fHandSize - numSubstitutes;
+                if ( numDealt == 0 )
+                    addSubstitutes( SWildCardHand(), 0, numSubstitutes );
+                else
+                {
+                    forEachCombination( fFixed, numDealt,
+                        [ this, numSubstitutes ]( SCardSpan cards, uint32_t /*mask*/ )
+                        {
+                            SWildCardHand hand;
+                            for ( auto&& ii : cards )
+                            {
+                                auto rank = ( ii >> 8 ) & 0x0F;
+                                hand.fPaired = hand.fPaired || ( hand.fCounts[ rank ] != 0 );
+                                hand.fCounts[ rank ]++;
+                                hand.fProduct *= ( ii & 0x00FF );
+                                hand.fRanks |= static_cast< uint16_t >( ii >> 16 );
+                                hand.fSuits |= static_cast< uint8_t >( ( ii >> 12 ) & 0x0F );
+                            }
+                            addSubstitutes( hand, 0, numSubstitutes );
+                            return !done();
+                        } );
+                }
+                if ( done() )
+                    break;
+            }
+            return fBest;
+        }
+    private:
+        bool done() const { return fBest <= fTarget; }
+
+        // substitutes are added in non decreasing rank order, so each rank multiset is visited once
+        void addSubstitutes( const SWildCardHand& hand, uint8_t firstRank, size_t numSubstitutes )
+        {
+            if ( numSubstitutes == 0 )
+            {
+                evaluate( hand );
+                return;
+            }
+
+            for ( uint8_t rank = firstRank; ( rank < 13 ) && !done(); ++rank )
+            {
+                if ( hand.fSubstitutes[ rank ] >= numSuits( fAvailableSuits[ rank ] ) )
+                    continue;
+
+                auto next = hand;
+                next.fPaired = next.fPaired || ( next.fCounts[ rank ] != 0 );
+                next.fCounts[ rank ]++;
+                next.fSubstitutes[ rank ]++;
+                next.fProduct *= sPrimes[ rank ];
+                next.fRanks |= static_cast< uint16_t >( 1 << rank );
+                next.fAnySuits |= fAvailableSuits[ rank ];
+                next.fCommonSuits &= fAvailableSuits[ rank ];
+                addSubstitutes( next, rank, numSubstitutes - 1 );
+            }
+        }
+
+        void evaluate( const SWildCardHand& hand )
+        {
+            auto straightsAndFlushesCount = fPlayInfo->fStraightsAndFlushesCount;
+            auto lowHandWins = fPlayInfo->fLowHandWins;
+            auto wildCards = fPlayInfo->hasWildCards();
+            auto rank = [ & ]( bool flush )
+            {
+                fBest = std::min( fBest, fCardInfoData->evaluateCardHand( hand.fRanks, hand.fProduct, flush, straightsAndFlushesCount, lowHandWins, wildCards ) );
+            };
+
+            if ( hand.fPaired || !straightsAndFlushesCount )
+            {
+                rank( false );
+                return;
+            }
+
+            // a flush needs one suit the dealt cards share and every substitute can take
+            // it is forced when that is the only suit on offer
+            auto dealtSuits = numSuits( hand.fSuits );
+            if ( ( dealtSuits <= 1 ) && ( ( hand.fSuits ? hand.fSuits : 0x0F ) & hand.fCommonSuits ) )
+                rank( true );
+            if ( numSuits( hand.fSuits | hand.fAnySuits ) > 1 )
+                rank( false );
+        }
+
+        static constexpr std::array< uint64_t, 13 > sPrimes = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41 };
+
+        const std::vector< TPackedCard >& fFixed;
+        size_t fNumCards{ 0 };
+        size_t fHandSize{ 0 };
+        std::shared_ptr< SPlayInfo > fPlayInfo;
+        const SCardInfoData * fCardInfoData{ nullptr };
+        std::array< uint8_t, 13 > fAvailableSuits;
+        uint32_t fBest{ kNoRank };
+        uint32_t fTarget{ 0 };
+    };
+
+    // the best hand from the rank and suit counts of the dealt cards and the number of wild cards
+    // the substitutions are then chosen in deck order, one wild card at a time, keeping the first that can still reach the best rank
+    // which is the first hand the expansion of each wild card over the deck finds, so the results are identical
+    // the rank and substitutions only depend on the dealt cards, so they are kept in the CWildCardCache
+    static SBestHand resolveWildCards( const std::vector< std::shared_ptr< CCard > >& inputCards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        auto noHand = SBestHand();
+
+        std::vector< TPackedCard > fixed;
+        size_t numWild = 0;
+        for ( auto&& ii : inputCards )
+        {
+            if ( playInfo->isWildCard( ii ) )
+                numWild++;
+            else
+                fixed.push_back( ii->packedValue() );
+        }
+
+        // a card dealt twice cant be made distinct
+        auto sorted = fixed;
+        std::sort( sorted.begin(), sorted.end() );
+        if ( std::adjacent_find( sorted.begin(), sorted.end() ) != sorted.end() )
+            return noHand;
+
+        static const auto sDeck = CCard::allCards(); // the same order as allCardsList
+
+        auto&& cache = CWildCardCache::instance();
+        CWildCardCache::SKey key;
+        auto cacheable = CWildCardCache::makeKey( fixed, numWild, playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins, key );
+        CWildCardCache::SValue value;
+        std::vector< uint8_t > substitutes; // one per wild card in the order they were dealt
+        if ( cacheable && cache.find( key, value ) )
+            substitutes.assign( value.fSubstitutes.begin(), value.fSubstitutes.begin() + value.fNumSubstitutes );
+        else
+        {
+            CWildCardSolver solver( fixed, inputCards.size(), playInfo );
+            value.fRank = solver.bestRank( numWild );
+            if ( value.fRank == kNoRank )
+                return noHand;
+
+            for ( auto remaining = numWild; remaining > 0; )
+            {
+                --remaining;
+                for ( uint8_t ii = 0; ii < sDeck.size(); ++ii )
+                {
+                    auto packedCandidate = sDeck[ ii ]->packedValue();
+                    if ( std::find( fixed.begin(), fixed.end(), packedCandidate ) != fixed.end() )
+                        continue;
+
+                    fixed.push_back( packedCandidate );
+                    if ( solver.bestRank( remaining, value.fRank ) == value.fRank )
+                    {
+                        substitutes.push_back( ii );
+                        break;
+                    }
+                    fixed.pop_back();
+                }
+            }
+            if ( cacheable )
+            {
+                value.fNumSubstitutes = static_cast< uint8_t >( substitutes.size() );
+                std::copy( substitutes.begin(), substitutes.end(), value.fSubstitutes.begin() );
+                cache.insert( key, value );
+            }
+        }
+
+        std::vector< std::shared_ptr< CCard > > hand;
+        size_t nextSubstitute = 0;
+        for ( auto&& ii : inputCards )
+        {
+            if ( !playInfo->isWildCard( ii ) )
+                hand.push_back( ii );
+            else if ( nextSubstitute < substitutes.size() )
+                hand.push_back( sDeck[ substitutes[ nextSubstitute++ ] ] );
+        }
+
+        std::vector< std::vector< std::shared_ptr< CCard > > > allHands = { hand };
+        return findBestHand( allHands, playInfo );
+    }
+
+    uint32_t evaluateHand( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        if ( cards.size() == 6 )
+            return C6CardInfo::evaluateCardHand( cards, playInfo );
+        if ( cards.size() == 7 )
+            return C7CardInfo::evaluateCardHand( cards, playInfo );
+        if ( cards.size() > 5 )
+            return findBest( cards, 5, playInfo ).first;
+        return evaluateHandInternal( cards, playInfo );
+    }
+
+    std::pair< uint32_t, EHand > evaluateHandAndType( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        if ( auto evaluator = playInfo->evaluator( cards.size() ) )
+            return evaluator->evaluate( cards );
+
+        auto rank = evaluateHand( cards, playInfo );
+        return { rank, rankToHand( rank, cards.size(), playInfo ) };
+    }
+
+    void evaluateHands( SCardSpan cards, size_t handSize, const std::shared_ptr< SPlayInfo >& playInfo, uint32_t * ranks )
+    {
+        switch ( handSize )
+        {
+            case 2:
+                return C2CardInfo::evaluateCardHands( cards, playInfo, ranks );
+            case 3:
+                return C3CardInfo::evaluateCardHands( cards, playInfo, ranks );
+            case 4:
+                return C4CardInfo::evaluateCardHands( cards, playInfo, ranks );
+            case 5:
+                return C5CardInfo::evaluateCardHands( cards, playInfo, ranks );
+            default:
+                break;
+        }
+        if ( handSize == 0 )
+            return;
+        for ( size_t ii = 0; ii < cards.size() / handSize; ++ii )
+            ranks[ ii ] = evaluateHand( SCardSpan( cards.begin() + ii * handSize, handSize ), playInfo );
+    }
+
+    SHandEvaluator bindHandEvaluator( size_t numCards, bool straightsAndFlushesCount, bool lowHandWins, bool wildCards )
+    {
+        static constexpr std::array< std::array< TEvaluateFunction, 8 >, 8 > sEvaluators =
+        {
+             std::array< TEvaluateFunction, 8 >{}
+            ,std::array< TEvaluateFunction, 8 >{}
+            ,variantEvaluators< C2CardInfo >()
+            ,variantEvaluators< C3CardInfo >()
+            ,variantEvaluators< C4CardInfo >()
+            ,variantEvaluators< C5CardInfo >()
+            ,variantEvaluators< C6CardInfo >()
+            ,variantEvaluators< C7CardInfo >()
+        };
+        using THandsByRankFunction = const STable< EHand > & ( * )( bool straightsAndFlushesCount, bool lowHandWins );
+        static constexpr std::array< THandsByRankFunction, 8 > sHandsByRank =
+        {
+             nullptr
+            ,nullptr
+            ,&C2CardInfo::handsByRank
+            ,&C3CardInfo::handsByRank
+            ,&C4CardInfo::handsByRank
+            ,&C5CardInfo::handsByRank
+            ,&C6CardInfo::handsByRank
+            ,&C7CardInfo::handsByRank
+        };
+
+        SHandEvaluator retVal;
+        if ( numCards >= sEvaluators.size() )
+            return retVal;
+        if ( numCards == 6 )
+            C6CardInfo::initMaps();
+        else if ( numCards == 7 )
+            C7CardInfo::initMaps();
+        retVal.fEvaluate = sEvaluators[ numCards ][ toVariantIndex( straightsAndFlushesCount, lowHandWins, wildCards ) ];
+        if ( !retVal.fEvaluate )
+            return retVal;
+        retVal.fHandsByRank = sHandsByRank[ numCards ]( straightsAndFlushesCount, lowHandWins );
+        retVal.fWildCards = wildCards;
+        retVal.fNumCards = numCards;
+        return retVal;
+    }
+
+    SHandEvaluator bindHandEvaluator( size_t numCards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        return bindHandEvaluator( numCards, playInfo->fStraightsAndFlushesCount, playInfo->fLowHandWins, playInfo->hasWildCards() );
+    }
+
+    size_t toPackedCards( const std::vector< std::shared_ptr< CCard > >& cards, TPackedCard * packedCards, size_t maxCards )
+    {
+        if ( cards.size() > maxCards )
+            return 0;
+
+        for ( size_t ii = 0; ii < cards.size(); ++ii )
+            packedCards[ ii ] = cards[ ii ]->packedValue();
+        return cards.size();
     }
 
     static std::unordered_map< ECard, uint32_t > sFiveOfAKindMap =
@@ -89,7 +1071,12 @@ namespace NHandUtils
         ,{ECard::eDeuce , 12 }
     };
 
-    std::pair< uint32_t, std::unique_ptr< CHand > > evaluateHand( const std::vector< std::shared_ptr< CCard > >& inputCards, const std::shared_ptr< SPlayInfo >& playInfo )
+    std::pair< uint32_t, std::unique_ptr< CHand > > evaluateHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        return evaluateBestHand( cards, playInfo ).toHand( playInfo );
+    }
+
+    SBestHand evaluateBestHand( const std::vector< std::shared_ptr< CCard > >& inputCards, const std::shared_ptr< SPlayInfo >& playInfo )
     {
         auto&& allCards = CCard::allCardsList();
         std::vector< std::list< std::shared_ptr< CCard > > > hands;
@@ -154,11 +1141,13 @@ namespace NHandUtils
                 // hand should have 4 cards....
                 while ( hand.size() != 5 )
                     hand.push_back( *hand.begin() );
-                auto retVal = std::make_pair( rank, std::make_unique< CHand >( hand, playInfo ) );
-                return retVal;
+                return { rank, hand, true };
             }
         }
 
+        if ( playInfo && playInfo->hasWildCards() && !gUseWildCardExpansion.load( std::memory_order_relaxed ) && ( inputCards.size() >= 2 ) && ( inputCards.size() <= 32 ) )
+            return resolveWildCards( inputCards, playInfo );
+
         std::function< bool( const std::vector< std::shared_ptr< CCard > >& curr, const std::shared_ptr< CCard >& obj ) > addToResult =
             []( const std::vector< std::shared_ptr< CCard > >& data, const std::shared_ptr< CCard >& obj )
         {
@@ -172,13 +1161,16 @@ namespace NHandUtils
         };
 
         auto allHands = NUtils::cartiseanProduct( hands, addToResult );
-        auto retVal = findBest( allHands, playInfo );
-
-        return retVal;
+        return findBestHand( allHands, playInfo );
     }
 
     uint32_t evaluateHandInternal( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo > & playInfo )
     {
+        auto evaluator = playInfo ? playInfo->evaluator( cards.size() ) : nullptr;
+        TPackedHand< 5 > packedCards;
+        if ( evaluator && ( toPackedCards( cards, packedCards.data(), packedCards.size() ) == cards.size() ) )
+            return ( *evaluator )( SCardSpan( packedCards.data(), cards.size() ) );
+
         if ( cards.size() == 2 )
             return C2CardInfo::evaluateCardHand( cards, playInfo );
         else if ( cards.size() == 3 )
@@ -187,11 +1179,35 @@ namespace NHandUtils
             return C4CardInfo::evaluateCardHand( cards, playInfo );
         else if ( cards.size() == 5 )
             return C5CardInfo::evaluateCardHand( cards, playInfo );
+        else if ( cards.size() == 6 )
+            return C6CardInfo::evaluateCardHand( cards, playInfo );
 
-        // 6 or greater is permuations of 5
+        // 7 or greater is permuations of 5
         return -1;
     }
 
+    uint32_t evaluateHandInternal( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo )
+    {
+        if ( auto evaluator = playInfo->evaluator( cards.size() ) )
+            return ( *evaluator )( cards );
+
+        switch ( cards.size() )
+        {
+            case 2:
+                return C2CardInfo::evaluateCardHand( cards, playInfo );
+            case 3:
+                return C3CardInfo::evaluateCardHand( cards, playInfo );
+            case 4:
+                return C4CardInfo::evaluateCardHand( cards, playInfo );
+            case 5:
+                return C5CardInfo::evaluateCardHand( cards, playInfo );
+            case 6:
+                return C6CardInfo::evaluateCardHand( cards, playInfo );
+            default:
+                return -1;
+        }
+    }
+
     bool isFlush( const std::vector< std::shared_ptr< CCard > >& cards )
     {
         if ( cards.empty() )
@@ -650,6 +1666,9 @@ namespace NHandUtils
     }
 
     bool gComputeAllHands{true};
+    std::atomic< bool > gUseLegacyProductMaps{false};
+    std::atomic< bool > gUseWildCardExpansion{false};
+    std::atomic< bool > gUseLegacyFindBest{false};
 }
 
 std::ostream& operator<<( std::ostream& oss, const std::vector< std::shared_ptr< CCard > >& cards )
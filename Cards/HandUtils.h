@@ -28,6 +28,10 @@
 #include <vector>
 #include <optional>
 #include <list>
+#include <array>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
 
 class CHand;
 class CCard;
@@ -70,6 +74,8 @@ namespace std
 
 namespace NHandUtils
 {
+    static constexpr uint32_t kNoRank = static_cast< uint32_t >( -1 ); // no hand, every rank is better
+
     using TCardBitType = std::bitset< 29 >; 
     // bits 
     // 2        2         1          
@@ -79,6 +85,253 @@ namespace NHandUtils
     //              16:12        - bit flag for suit
     //             17:29         - Bit flag for card
 
+    // Same layout as TCardBitType, but a plain value so the evaluator can work 
+    // on stack arrays of cards rather than vectors of shared pointers
+    using TPackedCard = uint32_t;
+    template< size_t N >
+    using TPackedHand = std::array< TPackedCard, N >;
+
+    // Non owning view of a contiguous run of packed cards
+    struct SCardSpan
+    {
+        SCardSpan() = default;
+        SCardSpan( const TPackedCard * cards, size_t numCards ) : fCards( cards ), fNumCards( numCards ) {}
+        template< size_t N >
+        SCardSpan( const TPackedHand< N > & cards ) : fCards( cards.data() ), fNumCards( N ) {}
+        SCardSpan( const std::vector< TPackedCard > & cards ) : fCards( cards.data() ), fNumCards( cards.size() ) {}
+
+        const TPackedCard * begin() const { return fCards; }
+        const TPackedCard * end() const { return fCards + fNumCards; }
+        size_t size() const { return fNumCards; }
+        bool empty() const { return fNumCards == 0; }
+        TPackedCard operator[]( size_t idx ) const { return fCards[ idx ]; }
+
+        const TPackedCard * fCards{ nullptr };
+        size_t fNumCards{ 0 };
+    };
+
+    // read only view of a table, the generated tables are constant arrays so they live in the read only data segment
+    template< typename T >
+    struct STable
+    {
+        const T & operator[]( size_t idx ) const { return fData[ idx ]; }
+        const T * data() const { return fData; }
+        size_t size() const { return fSize; }
+        bool empty() const { return fSize == 0; }
+        const T * begin() const { return fData; }
+        const T * end() const { return fData + fSize; }
+
+        const T * fData{ nullptr };
+        size_t fSize{ 0 };
+    };
+
+    template< typename T, size_t N >
+    constexpr STable< T > makeTable( const T ( &data )[ N ] )
+    {
+        return STable< T >{ data, N };
+    }
+
+    template< typename T >
+    STable< T > makeTable( const std::vector< T > & data )
+    {
+        return STable< T >{ data.data(), data.size() };
+    }
+
+    // the hand type tables are indexed by the rank including the wild card offset, ranks without wild cards are shifted up by 13
+    // so the first 13 entries are five of a kind for 5 cards, out of range ranks clamp to the last entry, the lowest hand type
+    inline EHand lookupHandType( const STable< EHand > & handsByRank, uint32_t rank, bool wildCards )
+    {
+        auto index = static_cast< uint64_t >( rank ) + ( wildCards ? 0 : 13 );
+        return handsByRank[ static_cast< size_t >( std::min< uint64_t >( index, handsByRank.size() - 1 ) ) ];
+    }
+
+    // returns the number of cards packed, 0 if the cards dont fit
+    size_t toPackedCards( const std::vector< std::shared_ptr< CCard > >& cards, TPackedCard * packedCards, size_t maxCards );
+
+    inline uint64_t computeHandProduct( SCardSpan cards )
+    {
+        if ( cards.empty() )
+            return -1;
+
+        uint64_t retVal = 1;
+        for ( auto&& ii : cards )
+            retVal *= ( ii & 0x00FF );
+        return retVal;
+    }
+
+    inline TPackedCard cardsOrValue( SCardSpan cards )
+    {
+        TPackedCard value = 0;
+        for ( auto&& ii : cards )
+            value |= ii;
+        return value;
+    }
+
+    inline TPackedCard cardsAndValue( SCardSpan cards )
+    {
+        if ( cards.empty() )
+            return 0;
+
+        TPackedCard value = ~TPackedCard( 0 );
+        for ( auto&& ii : cards )
+            value &= ii;
+        return value;
+    }
+
+    inline uint16_t getCardsValue( SCardSpan cards )
+    {
+        if ( cards.empty() )
+            return -1;
+        return static_cast< uint16_t >( cardsOrValue( cards ) >> 16 );
+    }
+
+    inline bool isFlush( SCardSpan cards )
+    {
+        return ( cardsAndValue( cards ) & 0x0F000 ) != 0;
+    }
+
+    // allocation free evaluation, cards are evaluated as dealt, wild cards are not substituted
+    // 2-7 cards are looked up directly, otherwise more than 5 returns the best 5 card rank
+    uint32_t evaluateHand( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo );
+    // returns the rank and a bit mask of the indexes into cards for the best numCards combination
+    std::pair< uint32_t, uint32_t > findBest( SCardSpan cards, size_t numCards, const std::shared_ptr< SPlayInfo >& playInfo );
+    // batch evaluation of cards.size() / handSize hands stored back to back, one rank per hand
+    void evaluateHands( SCardSpan cards, size_t handSize, const std::shared_ptr< SPlayInfo >& playInfo, uint32_t * ranks );
+    // returns the bit mask of the first numCards combination that evaluates to rank, 0 if there is none
+    uint32_t findCombination( SCardSpan cards, size_t numCards, uint32_t rank, const std::shared_ptr< SPlayInfo >& playInfo );
+
+    // counters for the best 5 of 6 to 10 card searches, safe to read while other threads search
+    struct SFindBestStats
+    {
+        uint64_t fSearches{ 0 };
+        uint64_t fCombinations{ 0 }; // the combinations the searches covered
+        uint64_t fEvaluated{ 0 }; // the combinations that were looked up
+        uint64_t fPruned{ 0 }; // the combinations that could not beat the best so far, or were decided by what the whole hand makes
+        uint64_t fShortCircuits{ 0 }; // searches answered without walking the combinations
+    };
+    SFindBestStats findBestStats();
+    void resetFindBestStats();
+
+    using TEvaluateFunction = uint32_t ( * )( SCardSpan cards );
+
+    // index of a rule variant in the tables returned by variantEvaluators
+    constexpr size_t toVariantIndex( bool straightsAndFlushesCount, bool lowHandWins, bool wildCards )
+    {
+        return ( straightsAndFlushesCount ? 4 : 0 ) + ( lowHandWins ? 2 : 0 ) + ( wildCards ? 1 : 0 );
+    }
+
+    // T provides static evaluateCardHand< StraightsAndFlushesCount, LowHandWins, WildCards >( SCardSpan )
+    template< typename T >
+    constexpr std::array< TEvaluateFunction, 8 > variantEvaluators()
+    {
+        return
+        {
+             &T::template evaluateCardHand< false, false, false >
+            ,&T::template evaluateCardHand< false, false, true >
+            ,&T::template evaluateCardHand< false, true, false >
+            ,&T::template evaluateCardHand< false, true, true >
+            ,&T::template evaluateCardHand< true, false, false >
+            ,&T::template evaluateCardHand< true, false, true >
+            ,&T::template evaluateCardHand< true, true, false >
+            ,&T::template evaluateCardHand< true, true, true >
+        };
+    }
+
+    // an evaluator compiled for one set of rules and hand size, there are no rule checks per hand
+    // bind again whenever the rules change
+    struct SHandEvaluator
+    {
+        uint32_t operator()( SCardSpan cards ) const { return fEvaluate( cards ); }
+        EHand handType( uint32_t rank ) const { return lookupHandType( fHandsByRank, rank, fWildCards ); }
+        std::pair< uint32_t, EHand > evaluate( SCardSpan cards ) const
+        {
+            auto rank = fEvaluate( cards );
+            return { rank, handType( rank ) };
+        }
+        explicit operator bool() const { return fEvaluate != nullptr; }
+
+        TEvaluateFunction fEvaluate{ nullptr };
+        STable< EHand > fHandsByRank;
+        bool fWildCards{ false };
+        size_t fNumCards{ 0 };
+    };
+
+    // 2 to 5 cards evaluate the hand, 6 and 7 cards are the best 5 of them, any other size is unbound
+    // wild cards are not substituted, wildCards only adds the wild card rank offset
+    SHandEvaluator bindHandEvaluator( size_t numCards, bool straightsAndFlushesCount, bool lowHandWins, bool wildCards );
+    SHandEvaluator bindHandEvaluator( size_t numCards, const std::shared_ptr< SPlayInfo >& playInfo );
+
+    // the rank and cards of the best hand, the searches only track the winner so no CHand is built until one is asked for
+    // 6 and 7 cards are ranked directly, the 5 cards that make the rank are only found when cards is called
+    struct SBestHand
+    {
+        SBestHand() = default;
+        SBestHand( uint32_t rank, std::vector< std::shared_ptr< CCard > > cards, bool sharesPlayInfo = false ) : fRank( rank ), fCards( std::move( cards ) ), fSharesPlayInfo( sharesPlayInfo ) {}
+
+        bool hasHand() const { return fRank != kNoRank; }
+        const std::vector< std::shared_ptr< CCard > >& cards( const std::shared_ptr< SPlayInfo >& playInfo ) const;
+        std::pair< uint32_t, std::unique_ptr< CHand > > toHand( const std::shared_ptr< SPlayInfo >& playInfo ) const;
+
+        uint32_t fRank{ kNoRank };
+        mutable std::vector< std::shared_ptr< CCard > > fCards; // empty when there is no hand or until cards finds them in fCandidates
+        bool fSharesPlayInfo{ false }; // five of a kind repeats a card, so the hand only evaluates with the wild cards
+        mutable std::vector< std::shared_ptr< CCard > > fCandidates; // the 6 or 7 cards the rank was found in
+    };
+
+    SBestHand findBestHand( const std::vector< std::shared_ptr< CCard > >& cards, int numCards, const std::shared_ptr< SPlayInfo > & playInfo );
+    SBestHand findBestHand( const std::vector< std::vector< std::shared_ptr< CCard > > >& allHands, const std::shared_ptr< SPlayInfo >& playInfo );
+    SBestHand evaluateBestHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo );
+
+    // the high and low halves of a hi/lo split hand, the high rank follows the play info rules
+    // the low is aces low 5 distinct ranks no higher than the qualifier, 1 is the wheel and lower is better
+    struct SHiLoRanks
+    {
+        bool hasLow() const { return fLow != kNoRank; }
+
+        uint32_t fHigh{ kNoRank };
+        uint32_t fLow{ kNoRank }; // kNoRank when no 5 cards qualify
+    };
+
+    // both halves from one pass over the cards and one walk of the 5 card combinations, the qualifier is playInfo->fLowQualifier
+    // fewer than 5 cards have no low
+    SHiLoRanks evaluateHiLo( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo );
+    // wild cards are substituted for the high only, the low plays the cards as dealt
+    SHiLoRanks evaluateHiLo( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo );
+
+    // the product, rank bits and common suits of a group of cards, a 5 card hand is looked up from the groups it is made of
+    struct SPartialHand
+    {
+        void addCard( TPackedCard card )
+        {
+            fProduct *= ( card & 0x00FF );
+            fRanks |= static_cast< uint16_t >( card >> 16 );
+            fSuits &= static_cast< uint8_t >( ( card >> 12 ) & 0x0F );
+        }
+
+        uint64_t fProduct{ 1 };
+        uint16_t fRanks{ 0 }; // the OR of the rank bits
+        uint8_t fSuits{ 0x0F }; // the suits every card is in, non zero when they are all one suit
+        uint32_t fMask{ 0 }; // the cards in the group
+    };
+
+    // every numCards combination of cards, build the board side once per deal and share it with every player at the table
+    std::vector< SPartialHand > partialHands( SCardSpan cards, size_t numCards );
+
+    struct SHoleAndBoardBest
+    {
+        uint32_t fRank{ kNoRank };
+        uint32_t fHoleMask{ 0 };
+        uint32_t fBoardMask{ 0 };
+    };
+
+    // the best 5 cards using exactly numHoleCards of the hole cards and the rest from the board, omaha is 2 and 3
+    // board is partialHands( board, 5 - numHoleCards ), -1 when the sizes do not add up to 5
+    // same rules as evaluateHand( SCardSpan ), wild cards are not substituted
+    SHoleAndBoardBest findBestHoleAndBoard( SCardSpan holeCards, size_t numHoleCards, const std::vector< SPartialHand > & board, const std::shared_ptr< SPlayInfo >& playInfo );
+    SBestHand findBestHoleAndBoard( const std::vector< std::shared_ptr< CCard > >& holeCards, size_t numHoleCards, const std::vector< std::shared_ptr< CCard > >& board, const std::shared_ptr< SPlayInfo >& playInfo );
+    // the low half of a hi/lo split from the same hole and board partial hands, kNoRank when no 5 cards qualify
+    uint32_t findBestLow( SCardSpan holeCards, size_t numHoleCards, const std::vector< SPartialHand > & board, const std::shared_ptr< SPlayInfo >& playInfo );
+
     std::pair< uint32_t, std::unique_ptr< CHand > > findBest( const std::vector< std::shared_ptr< CCard > >& cards, int numCards, const std::shared_ptr< SPlayInfo > & playInfo );
     std::pair< uint32_t, std::unique_ptr< CHand > > findBest( const std::vector< std::vector< std::shared_ptr< CCard > > >& allHands, const std::shared_ptr< SPlayInfo >& playInfo );
     std::pair< uint32_t, std::unique_ptr< CHand > > evaluateHand( const std::vector< std::shared_ptr< CCard > >& cards, const std::shared_ptr< SPlayInfo >& playInfo );
@@ -106,6 +359,8 @@ namespace NHandUtils
     ECard getMinCard( const std::vector< std::shared_ptr< CCard > >& cards );
 
     EHand rankToHand( uint32_t rank, size_t numCards, const std::shared_ptr< SPlayInfo > & playInfo );
+    // the rank and hand type of the cards as dealt, same rules as evaluateHand( SCardSpan )
+    std::pair< uint32_t, EHand > evaluateHandAndType( SCardSpan cards, const std::shared_ptr< SPlayInfo >& playInfo );
 
     TCardBitType computeBitValue( const TCard & card );
     TCardBitType computeBitValue( ECard card, ESuit suit );
@@ -144,6 +399,9 @@ namespace NHandUtils
     bool isStraightOrFlush( EHand handType );
 
     extern bool gComputeAllHands;
+    extern std::atomic< bool > gUseLegacyProductMaps; // use the unordered_map product lookup rather than the perfect hash, for A/B comparisons
+    extern std::atomic< bool > gUseWildCardExpansion; // expand each wild card over the deck rather than solving for the substitutions, for A/B comparisons
+    extern std::atomic< bool > gUseLegacyFindBest; // evaluate each combination from scratch rather than walking them in revolving door order, for A/B comparisons
 }
 
 std::ostream& operator<<( std::ostream& oss, const std::vector< std::shared_ptr< CCard > >& cards );
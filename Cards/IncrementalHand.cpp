@@ -0,0 +1,150 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "IncrementalHand.h"
+#include "Evaluate2CardHand.h"
+#include "Evaluate3CardHand.h"
+#include "Evaluate4CardHand.h"
+#include "Evaluate5CardHand.h"
+#include "Evaluate6CardHand.h"
+#include "Evaluate7CardHand.h"
+#include "Card.h"
+#include "Hand.h"
+#include "PlayInfo.h"
+
+namespace NHandUtils
+{
+    CIncrementalHand::CIncrementalHand( const std::shared_ptr< SPlayInfo > & playInfo ) :
+        fPlayInfo( playInfo )
+    {
+        if ( !fPlayInfo )
+            fPlayInfo = std::make_shared< SPlayInfo >();
+    }
+
+    bool CIncrementalHand::push( TPackedCard card )
+    {
+        if ( full() )
+            return false;
+
+        fCards[ fNumCards++ ] = card;
+        auto suit = ( card >> 12 ) & 0x0F;
+        if ( fRankCounts[ ( card >> 8 ) & 0x0F ]++ == 0 )
+            fCardsValue |= static_cast< uint16_t >( card >> 16 );
+        fSuitCounts[ suit ]++;
+        fSuitRanks[ suit ] |= static_cast< uint16_t >( card >> 16 );
+        fProduct *= ( card & 0x00FF );
+        update();
+        return true;
+    }
+
+    bool CIncrementalHand::push( const std::shared_ptr< CCard > & card )
+    {
+        return push( card->packedValue() );
+    }
+
+    void CIncrementalHand::pop()
+    {
+        if ( empty() )
+            return;
+
+        auto card = fCards[ --fNumCards ];
+        auto suit = ( card >> 12 ) & 0x0F;
+        if ( --fRankCounts[ ( card >> 8 ) & 0x0F ] == 0 )
+            fCardsValue &= ~static_cast< uint16_t >( card >> 16 );
+        fSuitCounts[ suit ]--;
+        fSuitRanks[ suit ] &= ~static_cast< uint16_t >( card >> 16 );
+        fProduct /= ( card & 0x00FF );
+        update();
+    }
+
+    void CIncrementalHand::clear()
+    {
+        fNumCards = 0;
+        fRankCounts = {};
+        fSuitCounts = {};
+        fSuitRanks = {};
+        fCardsValue = 0;
+        fProduct = 1;
+        fRank = -1;
+    }
+
+    EHand CIncrementalHand::handType() const
+    {
+        if ( empty() )
+            return EHand::eNoCards;
+        return rankToHand( fRank, fNumCards, fPlayInfo );
+    }
+
+    uint8_t CIncrementalHand::rankCount( ECard card ) const
+    {
+        auto rank = toRankValue( card );
+        if ( rank >= fRankCounts.size() )
+            return 0;
+        return fRankCounts[ rank ];
+    }
+
+    uint8_t CIncrementalHand::suitCount( ESuit suit ) const
+    {
+        return fSuitCounts[ static_cast< uint8_t >( suit ) ];
+    }
+
+    void CIncrementalHand::update()
+    {
+        auto straightsAndFlushesCount = fPlayInfo->fStraightsAndFlushesCount;
+        auto lowHandWins = fPlayInfo->fLowHandWins;
+        auto wildCards = fPlayInfo->hasWildCards();
+        // all the cards are one suit when the suit of the first card has them all
+        auto flush = fNumCards && ( fSuitCounts[ ( fCards[ 0 ] >> 12 ) & 0x0F ] == fNumCards );
+        switch ( fNumCards )
+        {
+            case 0:
+            case 1:
+                fRank = -1;
+                break;
+            case 2:
+                fRank = C2CardInfo::cardInfoData().evaluateCardHand( fCardsValue, fProduct, flush, straightsAndFlushesCount, lowHandWins, wildCards );
+                break;
+            case 3:
+                fRank = C3CardInfo::cardInfoData().evaluateCardHand( fCardsValue, fProduct, flush, straightsAndFlushesCount, lowHandWins, wildCards );
+                break;
+            case 4:
+                fRank = C4CardInfo::cardInfoData().evaluateCardHand( fCardsValue, fProduct, flush, straightsAndFlushesCount, lowHandWins, wildCards );
+                break;
+            case 5:
+                fRank = C5CardInfo::cardInfoData().evaluateCardHand( fCardsValue, fProduct, flush, straightsAndFlushesCount, lowHandWins, wildCards );
+                break;
+            case 6:
+                if ( !C6CardInfo::sCardInfoData.fTablesInitialized.load( std::memory_order_acquire ) )
+                    C6CardInfo::initMaps();
+                fRank = C6CardInfo::evaluateCardHandNoInit( fProduct, fSuitRanks, straightsAndFlushesCount, lowHandWins, wildCards );
+                break;
+            case 7:
+                if ( !C7CardInfo::sCardInfoData.fTablesInitialized.load( std::memory_order_acquire ) )
+                    C7CardInfo::initMaps();
+                fRank = C7CardInfo::evaluateCardHandNoInit( fProduct, fSuitRanks, straightsAndFlushesCount, lowHandWins, wildCards );
+                break;
+            default:
+                fRank = evaluateHand( cards(), fPlayInfo );
+                break;
+        }
+    }
+}
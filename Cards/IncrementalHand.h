@@ -0,0 +1,76 @@
+#ifndef __INCREMENTALHAND_H
+#define __INCREMENTALHAND_H
+
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "HandUtils.h"
+#include <memory>
+#include <array>
+
+class CCard;
+struct SPlayInfo;
+enum class EHand;
+
+namespace NHandUtils
+{
+    // Evaluation state for cards that are dealt one at a time, stud streets or walking a deal tree
+    // push and pop keep the rank counts, suit counts and rank bits up to date so the rank of the cards so far is a table lookup
+    // 2 to 7 cards are looked up directly, any other size falls back to evaluateHand( SCardSpan )
+    // same rules as evaluateHand( SCardSpan ), the cards are evaluated as dealt and wild cards are not substituted
+    class CIncrementalHand
+    {
+    public:
+        CIncrementalHand( const std::shared_ptr< SPlayInfo > & playInfo );
+
+        bool push( TPackedCard card ); // returns false when the hand is full
+        bool push( const std::shared_ptr< CCard > & card );
+        void pop(); // removes the last card pushed
+        void clear();
+
+        uint32_t rank() const { return fRank; }
+        EHand handType() const;
+
+        size_t size() const { return fNumCards; }
+        bool empty() const { return fNumCards == 0; }
+        bool full() const { return fNumCards == fCards.size(); }
+        SCardSpan cards() const { return SCardSpan( fCards.data(), fNumCards ); }
+
+        uint8_t rankCount( ECard card ) const;
+        uint8_t suitCount( ESuit suit ) const;
+        uint16_t cardsValue() const { return fCardsValue; }
+    private:
+        void update();
+
+        std::shared_ptr< SPlayInfo > fPlayInfo;
+        TPackedHand< 10 > fCards;
+        size_t fNumCards{ 0 };
+        std::array< uint8_t, 13 > fRankCounts{}; // indexed by the rank value of the card
+        std::array< uint8_t, 16 > fSuitCounts{}; // indexed by the one hot suit bits
+        std::array< uint16_t, 16 > fSuitRanks{}; // rank bits of each suit, indexed by the one hot suit bits
+        uint16_t fCardsValue{ 0 }; // rank bits of all the cards
+        uint64_t fProduct{ 1 };
+        uint32_t fRank{ kNoRank };
+    };
+}
+
+#endif
@@ -0,0 +1,143 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Log.h"
+#include <iostream>
+
+std::atomic< ELogLevel > CLog::sLevel{ ELogLevel::eOff };
+
+static std::mutex sSinkMutex;
+static std::shared_ptr< CLogSink > sSink;
+
+void CStreamLogSink::write( ELogLevel /*level*/, std::string && msg )
+{
+    std::lock_guard< std::mutex > lock( fMutex );
+    fStream << msg;
+}
+
+void CStreamLogSink::flush()
+{
+    std::lock_guard< std::mutex > lock( fMutex );
+    fStream.flush();
+}
+
+CAsyncLogWriter::CAsyncLogWriter( const std::string & fileName ) :
+    fFile( fileName ),
+    fStream( fFile ),
+    fThread( &CAsyncLogWriter::run, this )
+{
+}
+
+CAsyncLogWriter::CAsyncLogWriter( std::ostream & stream ) :
+    fStream( stream ),
+    fThread( &CAsyncLogWriter::run, this )
+{
+}
+
+CAsyncLogWriter::~CAsyncLogWriter()
+{
+    {
+        std::lock_guard< std::mutex > lock( fMutex );
+        fStop = true;
+    }
+    fQueuedCV.notify_one();
+    fThread.join();
+}
+
+bool CAsyncLogWriter::isOpen() const
+{
+    return fStream.good();
+}
+
+void CAsyncLogWriter::write( ELogLevel /*level*/, std::string && msg )
+{
+    static const size_t sBatchSize = 256;
+    bool wake = false;
+    {
+        std::lock_guard< std::mutex > lock( fMutex );
+        fQueue.push_back( std::move( msg ) );
+        fNumQueued++;
+        wake = fQueue.size() >= sBatchSize;
+    }
+    if ( wake )
+        fQueuedCV.notify_one();
+}
+
+void CAsyncLogWriter::flush()
+{
+    std::unique_lock< std::mutex > lock( fMutex );
+    auto numQueued = fNumQueued;
+    fQueuedCV.notify_one();
+    fWrittenCV.wait( lock, [ this, numQueued ]() { return fNumWritten >= numQueued; } );
+}
+
+// a partial batch is written after a short wait so a quiet log still reaches the stream
+void CAsyncLogWriter::run()
+{
+    std::vector< std::string > batch;
+    std::unique_lock< std::mutex > lock( fMutex );
+    while ( true )
+    {
+        fQueuedCV.wait_for( lock, std::chrono::milliseconds( 100 ), [ this ]() { return fStop || !fQueue.empty(); } );
+        if ( fQueue.empty() )
+        {
+            if ( fStop )
+                break;
+            continue;
+        }
+
+        batch.swap( fQueue );
+        lock.unlock();
+        for ( auto&& ii : batch )
+            fStream << ii;
+        fStream.flush();
+        lock.lock();
+
+        fNumWritten += batch.size();
+        batch.clear();
+        fWrittenCV.notify_all();
+    }
+}
+
+void CLog::setSink( std::shared_ptr< CLogSink > sink )
+{
+    std::lock_guard< std::mutex > lock( sSinkMutex );
+    sSink = sink;
+}
+
+std::shared_ptr< CLogSink > CLog::sink()
+{
+    std::lock_guard< std::mutex > lock( sSinkMutex );
+    if ( !sSink )
+        sSink = std::make_shared< CStreamLogSink >( std::cerr );
+    return sSink;
+}
+
+void CLog::write( ELogLevel level, const QString & msg )
+{
+    write( level, msg.toStdString() );
+}
+
+void CLog::write( ELogLevel level, std::string && msg )
+{
+    sink()->write( level, std::move( msg ) );
+}
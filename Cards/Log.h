@@ -0,0 +1,114 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _LOG_H
+#define _LOG_H
+
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <QString>
+
+enum class ELogLevel : uint8_t
+{
+    eOff,
+    eError,
+    eWarning,
+    eInfo, // one hand history record per deal
+    eDebug,
+    eTrace // every player before and after the winners are sorted
+};
+
+// where the enabled messages go, written to from any thread
+class CLogSink
+{
+public:
+    virtual ~CLogSink() {}
+    virtual void write( ELogLevel level, std::string && msg ) = 0;
+    virtual void flush() {}
+};
+
+// writes each message as it comes in, the default sink is one of these on std::cerr
+class CStreamLogSink : public CLogSink
+{
+public:
+    CStreamLogSink( std::ostream & stream ) : fStream( stream ) {}
+
+    void write( ELogLevel level, std::string && msg ) override;
+    void flush() override;
+private:
+    std::mutex fMutex;
+    std::ostream & fStream;
+};
+
+// queues the messages and writes them in batches from its own thread, the dealing threads never wait on the stream
+class CAsyncLogWriter : public CLogSink
+{
+public:
+    CAsyncLogWriter( const std::string & fileName ); // check isOpen
+    CAsyncLogWriter( std::ostream & stream ); // the stream must outlive the writer
+    ~CAsyncLogWriter(); // writes what is queued
+
+    bool isOpen() const;
+    void write( ELogLevel level, std::string && msg ) override;
+    void flush() override; // waits until everything queued so far is written
+private:
+    void run();
+
+    std::ofstream fFile;
+    std::ostream & fStream;
+    std::mutex fMutex;
+    std::condition_variable fQueuedCV;
+    std::condition_variable fWrittenCV;
+    std::vector< std::string > fQueue;
+    uint64_t fNumQueued{ 0 };
+    uint64_t fNumWritten{ 0 };
+    bool fStop{ false };
+    std::thread fThread;
+};
+
+// nothing is formatted unless the level is enabled, check enabled before building the message
+//     if ( CLog::enabled( ELogLevel::eTrace ) )
+//         CLog::write( ELogLevel::eTrace, ... );
+// off by default
+class CLog
+{
+public:
+    static bool enabled( ELogLevel level ) { return ( level != ELogLevel::eOff ) && ( level <= sLevel.load( std::memory_order_relaxed ) ); }
+    static void setLevel( ELogLevel level ) { sLevel.store( level, std::memory_order_relaxed ); }
+    static ELogLevel level() { return sLevel.load( std::memory_order_relaxed ); }
+
+    static void setSink( std::shared_ptr< CLogSink > sink ); // nullptr writes to std::cerr
+    static std::shared_ptr< CLogSink > sink();
+
+    static void write( ELogLevel level, const QString & msg );
+    static void write( ELogLevel level, std::string && msg );
+private:
+    static std::atomic< ELogLevel > sLevel;
+};
+
+#endif
@@ -23,6 +23,10 @@
 #ifndef _PLAYINFO_H
 #define _PLAYINFO_H
 
+#include "HandUtils.h"
+#include "Card.h"
+#include <array>
+
 struct SPlayInfo
 {
     bool hasWildCards() const
@@ -33,9 +37,36 @@ struct SPlayInfo
     {
         return fWildCards.find( card ) != fWildCards.end();
     }
+
+    // binds an evaluator for each supported hand size to the current rules
+    // once bound the rules must not be changed without binding again, CGame does this for its play info
+    void bindEvaluators()
+    {
+        for ( size_t ii = 0; ii < fEvaluators.size(); ++ii )
+            fEvaluators[ ii ] = NHandUtils::bindHandEvaluator( ii, fStraightsAndFlushesCount, fLowHandWins, hasWildCards() );
+    }
+    void clearEvaluators()
+    {
+        fEvaluators = {};
+    }
+    bool evaluatorsBound() const
+    {
+        return static_cast< bool >( fEvaluators[ 5 ] );
+    }
+    // nullptr when no evaluator is bound for numCards
+    const NHandUtils::SHandEvaluator * evaluator( size_t numCards ) const
+    {
+        if ( ( numCards >= fEvaluators.size() ) || !fEvaluators[ numCards ] )
+            return nullptr;
+        return &fEvaluators[ numCards ];
+    }
+
     std::unordered_set< std::shared_ptr< CCard > > fWildCards;
     bool fLowHandWins{ false };
     bool fStraightsAndFlushesCount{ true };
+    bool fHiLoSplit{ false }; // the pot is split between the best high and the best qualifying low
+    ECard fLowQualifier{ ECard::eEight }; // the highest card a qualifying low may hold
+    std::array< NHandUtils::SHandEvaluator, 8 > fEvaluators; // indexed by the number of cards
 };
 
 #endif 
@@ -125,3 +125,8 @@ void CPlayer::clearCards()
 {
     fHand->clearCards();
 }
+
+void CPlayer::setBoard( const std::shared_ptr< const NHandUtils::CBoardContext > & board )
+{
+    fHand->setBoard( board );
+}
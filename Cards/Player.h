@@ -32,6 +32,10 @@ class CCard;
 enum class ECard;
 enum class EHand;
 struct SPlayInfo;
+namespace NHandUtils
+{
+    class CBoardContext;
+}
 
 class CPlayer 
 {
@@ -77,6 +81,7 @@ public:
     void addCard( std::shared_ptr< CCard > card );
     void setCards( const std::vector< std::shared_ptr< CCard > > & cards );
     void clearCards();
+    void setBoard( const std::shared_ptr< const NHandUtils::CBoardContext > & board );
 private:
     QString fName;
     size_t fPlayerID{ 0 };
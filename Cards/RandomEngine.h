@@ -0,0 +1,150 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _RANDOMENGINE_H
+#define _RANDOMENGINE_H
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+// the random engine used to shuffle and deal, CGame uses CXoshiro256StarStar unless another is set
+// also a UniformRandomBitGenerator so it can be handed to the std distributions
+class CRandomEngine
+{
+public:
+    using result_type = uint64_t;
+    virtual ~CRandomEngine() {}
+
+    virtual void seed( uint64_t seed ) = 0;
+    virtual uint64_t next() = 0;
+    virtual std::unique_ptr< CRandomEngine > clone() const = 0; // same engine and state
+
+    // uniform in [0,range), range must be less than 2^32, Lemire's multiply and reject
+    uint32_t bounded( uint32_t range )
+    {
+        uint64_t product = ( next() >> 32 ) * range;
+        auto low = static_cast< uint32_t >( product );
+        if ( low < range )
+        {
+            auto threshold = static_cast< uint32_t >( -range ) % range;
+            while ( low < threshold )
+            {
+                product = ( next() >> 32 ) * range;
+                low = static_cast< uint32_t >( product );
+            }
+        }
+        return static_cast< uint32_t >( product >> 32 );
+    }
+
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return std::numeric_limits< uint64_t >::max(); }
+    uint64_t operator()() { return next(); }
+};
+
+namespace NRandom
+{
+    // the splitmix64 finalizer, a bijection that spreads neighboring values apart
+    inline uint64_t mix64( uint64_t value )
+    {
+        value = ( value ^ ( value >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+        value = ( value ^ ( value >> 27 ) ) * 0x94D049BB133111EBULL;
+        return value ^ ( value >> 31 );
+    }
+
+    inline uint64_t splitMix64( uint64_t & state )
+    {
+        return mix64( state += 0x9E3779B97F4A7C15ULL );
+    }
+}
+
+// xoshiro256** by Blackman and Vigna, the state is filled from the seed with splitmix64
+class CXoshiro256StarStar : public CRandomEngine
+{
+public:
+    CXoshiro256StarStar( uint64_t seed = 0 ) { CXoshiro256StarStar::seed( seed ); }
+
+    void seed( uint64_t seed ) override
+    {
+        for ( auto&& ii : fState )
+            ii = NRandom::splitMix64( seed );
+    }
+    uint64_t next() override
+    {
+        auto retVal = rotl( fState[ 1 ] * 5, 7 ) * 9;
+        auto t = fState[ 1 ] << 17;
+        fState[ 2 ] ^= fState[ 0 ];
+        fState[ 3 ] ^= fState[ 1 ];
+        fState[ 1 ] ^= fState[ 2 ];
+        fState[ 0 ] ^= fState[ 3 ];
+        fState[ 2 ] ^= t;
+        fState[ 3 ] = rotl( fState[ 3 ], 45 );
+        return retVal;
+    }
+    std::unique_ptr< CRandomEngine > clone() const override { return std::make_unique< CXoshiro256StarStar >( *this ); }
+private:
+    static uint64_t rotl( uint64_t value, int shift ) { return ( value << shift ) | ( value >> ( 64 - shift ) ); }
+
+    uint64_t fState[ 4 ];
+};
+
+// counter based, value ii of a stream is a hash of the seed, the stream and ii
+// so any stream can be started without generating the streams before it, CGame deals deal k of a seed from stream k
+class CCounterRandomEngine : public CRandomEngine
+{
+public:
+    CCounterRandomEngine( uint64_t seed = 0, uint64_t stream = 0 ) : fKey( NRandom::mix64( seed ) ) { setStream( stream ); }
+
+    void seed( uint64_t seed ) override
+    {
+        fKey = NRandom::mix64( seed );
+        setStream( 0 );
+    }
+    void setStream( uint64_t stream )
+    {
+        fStreamKey = NRandom::mix64( fKey + stream * 0x9E3779B97F4A7C15ULL );
+        fCounter = 0;
+    }
+    uint64_t next() override { return NRandom::mix64( fStreamKey ^ NRandom::mix64( ++fCounter ) ); }
+    std::unique_ptr< CRandomEngine > clone() const override { return std::make_unique< CCounterRandomEngine >( *this ); }
+private:
+    uint64_t fKey{ 0 };
+    uint64_t fStreamKey{ 0 };
+    uint64_t fCounter{ 0 };
+};
+
+// wraps any 64 bit std engine, ie std::mt19937_64
+template< typename T >
+class CStdRandomEngine : public CRandomEngine
+{
+    static_assert( ( T::min() == 0 ) && ( T::max() == std::numeric_limits< uint64_t >::max() ), "CRandomEngine needs 64 random bits per call" );
+public:
+    CStdRandomEngine( uint64_t seed = 0 ) : fEngine( seed ) {}
+
+    void seed( uint64_t seed ) override { fEngine.seed( seed ); }
+    uint64_t next() override { return static_cast< uint64_t >( fEngine() ); }
+    std::unique_ptr< CRandomEngine > clone() const override { return std::make_unique< CStdRandomEngine< T > >( *this ); }
+private:
+    T fEngine;
+};
+
+#endif
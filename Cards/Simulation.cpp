@@ -0,0 +1,142 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Simulation.h"
+#include <random>
+
+CSimulation::CSimulation( const CGame & game, size_t numThreads ) :
+    fGame( game.cloneConfiguration() )
+{
+    if ( numThreads == 0 )
+        numThreads = std::max( 1U, std::thread::hardware_concurrency() );
+
+    for ( size_t ii = 0; ii < numThreads; ++ii )
+    {
+        auto worker = std::make_unique< SWorker >();
+        worker->fGame = game.cloneConfiguration();
+        worker->fStats = worker->fGame->stats();
+        fWorkers.push_back( std::move( worker ) );
+    }
+}
+
+CSimulation::~CSimulation()
+{
+    stop();
+}
+
+void CSimulation::setSeed( std::optional< uint64_t > seed )
+{
+    fSeed = seed;
+}
+
+void CSimulation::start( uint64_t numDeals )
+{
+    stop();
+    fStop = false;
+
+    std::random_device rd;
+    for ( size_t ii = 0; ii < fWorkers.size(); ++ii )
+    {
+        auto&& worker = *fWorkers[ ii ];
+        worker.fGame = fGame->cloneConfiguration(); // the dealer starts over too
+        if ( !fSeed.has_value() )
+            worker.fGame->setSeed( ( uint64_t( rd() ) << 32 ) | rd() );
+        worker.fStats = worker.fGame->stats();
+
+        if ( ( numDeals != 0 ) && ( ii >= numDeals ) )
+            continue;
+        worker.fThread = std::thread( &CSimulation::runWorker, this, std::ref( worker ), ii, numDeals );
+    }
+}
+
+void CSimulation::wait()
+{
+    for ( auto&& ii : fWorkers )
+    {
+        if ( ii->fThread.joinable() )
+            ii->fThread.join();
+    }
+}
+
+void CSimulation::stop()
+{
+    fStop = true;
+    wait();
+}
+
+bool CSimulation::running() const
+{
+    for ( auto&& ii : fWorkers )
+    {
+        if ( ii->fThread.joinable() )
+            return true;
+    }
+    return false;
+}
+
+SGameStats CSimulation::run( uint64_t numDeals )
+{
+    start( numDeals );
+    wait();
+    return stats();
+}
+
+// worker N deals every deal index equal to N modulo the number of workers, no coordination is needed
+// the statistics are published every so many deals, the workers only share the lock with stats()
+void CSimulation::runWorker( SWorker & worker, size_t workerIndex, uint64_t numDeals )
+{
+    static const uint64_t sDealsPerPublish = 256;
+    uint64_t dealIndex = workerIndex;
+    while ( !fStop.load( std::memory_order_relaxed ) && ( ( numDeals == 0 ) || ( dealIndex < numDeals ) ) )
+    {
+        for ( uint64_t ii = 0; ( ii < sDealsPerPublish ) && ( ( numDeals == 0 ) || ( dealIndex < numDeals ) ); ++ii, dealIndex += fWorkers.size() )
+        {
+            if ( fSeed.has_value() )
+                worker.fGame->shuffleAndDeal( fSeed.value(), dealIndex );
+            else
+            {
+                worker.fGame->nextDealer();
+                worker.fGame->shuffleAndDeal();
+            }
+        }
+
+        auto stats = worker.fGame->stats();
+        std::lock_guard< std::mutex > lock( worker.fMutex );
+        worker.fStats = std::move( stats );
+    }
+}
+
+SGameStats CSimulation::stats() const
+{
+    auto retVal = fGame->stats();
+    for ( auto&& ii : fWorkers )
+    {
+        std::lock_guard< std::mutex > lock( ii->fMutex );
+        retVal.add( ii->fStats );
+    }
+    return retVal;
+}
+
+QString CSimulation::dumpStats() const
+{
+    return fGame->dumpStats( stats() );
+}
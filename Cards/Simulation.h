@@ -0,0 +1,72 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _SIMULATION_H
+#define _SIMULATION_H
+
+#include "Game.h"
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <optional>
+
+// Deals a game on several threads at once, each worker deals its own clone of the game configuration
+// the workers publish their statistics every few deals so they can be merged while running
+// with a seed the run is deal 0 to numDeals - 1 of the seed, see CGame::shuffleAndDeal, the same seed and deals give the same statistics on any number of workers
+class CSimulation
+{
+public:
+    CSimulation( const CGame & game, size_t numThreads = 0 ); // 0 is one worker per hardware thread
+    ~CSimulation();
+
+    size_t numThreads() const { return fWorkers.size(); }
+    void setSeed( std::optional< uint64_t > seed ); // unset seeds each worker randomly
+
+    // the deals are split evenly between the workers, 0 deals until stop is called
+    // the statistics start over on each run
+    void start( uint64_t numDeals );
+    void wait();
+    void stop();
+    bool running() const;
+    SGameStats run( uint64_t numDeals ); // start then wait
+
+    SGameStats stats() const; // merged over the workers, safe to call while running
+    QString dumpStats() const;
+private:
+    struct SWorker
+    {
+        std::unique_ptr< CGame > fGame;
+        std::thread fThread;
+        mutable std::mutex fMutex;
+        SGameStats fStats; // published by the worker thread
+    };
+    void runWorker( SWorker & worker, size_t workerIndex, uint64_t numDeals );
+
+    std::unique_ptr< CGame > fGame; // the configuration, names the players in dumpStats
+    std::vector< std::unique_ptr< SWorker > > fWorkers;
+    std::optional< uint64_t > fSeed;
+    std::atomic< bool > fStop{ false };
+};
+
+#endif
@@ -0,0 +1,118 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TableRegistry.h"
+#include "Evaluate2CardHand.h"
+#include "Evaluate3CardHand.h"
+#include "Evaluate4CardHand.h"
+#include "Evaluate5CardHand.h"
+#include "Evaluate6CardHand.h"
+#include "Evaluate7CardHand.h"
+
+#include <future>
+#include <sstream>
+
+namespace NHandUtils
+{
+    std::vector< CTableRegistry::ETable > CTableRegistry::allTables()
+    {
+        return { ETable::e2Card, ETable::e3Card, ETable::e4Card, ETable::e5Card, ETable::e6Card, ETable::e7Card };
+    }
+
+    std::string CTableRegistry::toString( ETable table )
+    {
+        switch ( table )
+        {
+            case ETable::e2Card: return "2 Card";
+            case ETable::e3Card: return "3 Card";
+            case ETable::e4Card: return "4 Card";
+            case ETable::e5Card: return "5 Card";
+            case ETable::e6Card: return "6 Card";
+            case ETable::e7Card: return "7 Card";
+        }
+        return "Unknown";
+    }
+
+    bool CTableRegistry::isReady( ETable table )
+    {
+        switch ( table )
+        {
+            case ETable::e2Card: return C2CardInfo::sCardInfoData.fTablesInitialized.load( std::memory_order_acquire );
+            case ETable::e3Card: return C3CardInfo::sCardInfoData.fTablesInitialized.load( std::memory_order_acquire );
+            case ETable::e4Card: return C4CardInfo::sCardInfoData.fTablesInitialized.load( std::memory_order_acquire );
+            case ETable::e5Card: return C5CardInfo::sCardInfoData.fTablesInitialized.load( std::memory_order_acquire );
+            case ETable::e6Card: return C6CardInfo::sCardInfoData.fTablesInitialized.load( std::memory_order_acquire );
+            case ETable::e7Card: return C7CardInfo::sCardInfoData.fTablesInitialized.load( std::memory_order_acquire );
+        }
+        return false;
+    }
+
+    bool CTableRegistry::allReady()
+    {
+        for ( auto&& ii : allTables() )
+        {
+            if ( !isReady( ii ) )
+                return false;
+        }
+        return true;
+    }
+
+    void CTableRegistry::initTable( ETable table )
+    {
+        switch ( table )
+        {
+            case ETable::e2Card: C2CardInfo::initMaps(); break;
+            case ETable::e3Card: C3CardInfo::initMaps(); break;
+            case ETable::e4Card: C4CardInfo::initMaps(); break;
+            case ETable::e5Card: C5CardInfo::initMaps(); break;
+            case ETable::e6Card: C6CardInfo::initMaps(); break;
+            case ETable::e7Card: C7CardInfo::initMaps(); break;
+        }
+    }
+
+    void CTableRegistry::initAll( bool parallel )
+    {
+        if ( !parallel )
+        {
+            for ( auto&& ii : allTables() )
+                initTable( ii );
+            return;
+        }
+
+        std::vector< std::future< void > > pending;
+        for ( auto&& ii : allTables() )
+        {
+            if ( !isReady( ii ) )
+                pending.push_back( std::async( std::launch::async, initTable, ii ) );
+        }
+        for ( auto&& ii : pending )
+            ii.get();
+    }
+
+    std::string CTableRegistry::readinessReport()
+    {
+        std::ostringstream oss;
+        for ( auto&& ii : allTables() )
+            oss << toString( ii ) << ": " << ( isReady( ii ) ? "ready" : "not ready" ) << "\n";
+        return oss.str();
+    }
+}
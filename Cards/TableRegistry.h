@@ -0,0 +1,61 @@
+#ifndef __TABLEREGISTRY_H
+#define __TABLEREGISTRY_H
+
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <string>
+#include <vector>
+
+namespace NHandUtils
+{
+    // Owns the readiness of the evaluator tables so evaluation can run from many threads
+    // The 2 to 5 card tables are constant initialized and always ready, the 6 and 7 card tables are derived at runtime
+    // Call initAll() once up front, after that the NoInit evaluation paths can be used with no per call checks
+    class CTableRegistry
+    {
+    public:
+        enum class ETable
+        {
+            e2Card,
+            e3Card,
+            e4Card,
+            e5Card,
+            e6Card,
+            e7Card
+        };
+
+        static std::vector< ETable > allTables();
+        static std::string toString( ETable table );
+
+        static bool isReady( ETable table );
+        static bool allReady();
+
+        static void initTable( ETable table ); // thread safe, returns once the table is ready
+        static void initAll( bool parallel = true ); // parallel builds each table on its own thread
+
+        static std::string readinessReport(); // one line per table
+    };
+}
+
+#endif
@@ -26,8 +26,11 @@
 #include "Cards/CardInfo.h"
 #include "Cards/Hand.h"
 #include "Cards/CardInfo.h"
+#include "Cards/PlayInfo.h"
 #include "SABUtils/utils.h"
 
+#include <algorithm>
+
 std::ostream& operator<<( std::ostream& os, const QString& data )
 {
     return os << data.toStdString();
@@ -219,6 +222,50 @@ namespace NHandTester
         return allCards;
     }
 
+    std::vector< std::shared_ptr< CCard > > CHandTester::dealCards( std::vector< std::shared_ptr< CCard > > & deck, std::mt19937_64 & gen, size_t numCards )
+    {
+        std::shuffle( deck.begin(), deck.end(), gen );
+        return std::vector< std::shared_ptr< CCard > >( deck.begin(), deck.begin() + std::min( numCards, deck.size() ) );
+    }
+
+    std::vector< NHandUtils::TPackedCard > CHandTester::dealPackedHands( std::mt19937_64 & gen, size_t numHands, size_t numCards )
+    {
+        auto deck = CCard::allCards();
+        std::vector< NHandUtils::TPackedCard > retVal;
+        retVal.reserve( numHands * numCards );
+        for ( size_t ii = 0; ii < numHands; ++ii )
+        {
+            for ( auto && card : dealCards( deck, gen, numCards ) )
+                retVal.push_back( card->packedValue() );
+        }
+        return retVal;
+    }
+
+    void CHandTester::forEachRule( const std::shared_ptr< SPlayInfo > & playInfo, bool wildCards, const std::function< void() > & func )
+    {
+        for ( auto && wild : { false, true } )
+        {
+            if ( wildCards )
+            {
+                playInfo->fWildCards.clear();
+                if ( wild )
+                    playInfo->fWildCards.insert( CCard::allCards().front() );
+            }
+            else if ( wild )
+                break;
+
+            for ( auto && straightsAndFlushesCount : { false, true } )
+            {
+                for ( auto && lowHandWins : { false, true } )
+                {
+                    playInfo->fStraightsAndFlushesCount = straightsAndFlushesCount;
+                    playInfo->fLowHandWins = lowHandWins;
+                    func();
+                }
+            }
+        }
+    }
+
     std::list< std::shared_ptr< NHandUtils::CCardInfo > > CHandTester::getAllCardInfoHands( size_t numCards )
     {
         auto allCards = getAllCards( numCards );
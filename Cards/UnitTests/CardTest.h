@@ -31,6 +31,11 @@ class CGame;
 #include <iostream>
 #include <tuple>
 #include <list>
+#include <vector>
+#include <memory>
+#include <random>
+#include <functional>
+#include "Cards/HandUtils.h"
 #include "gmock/gmock.h"
 
 std::ostream& operator<<( std::ostream& os, const QString & data );
@@ -69,6 +74,14 @@ namespace NHandTester
         std::list< std::shared_ptr< CHand > > getAllCHandHands( size_t numCards );
     public:
         std::vector< std::vector< std::shared_ptr< CCard > > > getAllCards( size_t numCards );
+
+        // shuffles the deck and returns its first numCards, the deck is left shuffled for the next deal
+        static std::vector< std::shared_ptr< CCard > > dealCards( std::vector< std::shared_ptr< CCard > > & deck, std::mt19937_64 & gen, size_t numCards );
+        // numHands deals of numCards from a freshly shuffled deck, packed back to back
+        static std::vector< NHandUtils::TPackedCard > dealPackedHands( std::mt19937_64 & gen, size_t numHands, size_t numCards );
+        // sets each straights and flushes count and low hand wins rule on playInfo and calls func
+        // with wildCards every rule is also run with the first card of the deck wild, otherwise the wild cards are left alone
+        static void forEachRule( const std::shared_ptr< SPlayInfo > & playInfo, bool wildCards, const std::function< void() > & func );
         CGame* fGame{ nullptr };
     };
 }  
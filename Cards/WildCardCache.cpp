@@ -0,0 +1,176 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "WildCardCache.h"
+#include "CardInfo.h"
+
+namespace NHandUtils
+{
+    CWildCardCache::CWildCardCache() :
+        fCapacity( 1 << 16 )
+    {
+    }
+
+    CWildCardCache& CWildCardCache::instance()
+    {
+        static CWildCardCache sInstance;
+        return sInstance;
+    }
+
+    bool CWildCardCache::makeKey( SCardSpan dealtCards, size_t numWild, bool straightsAndFlushesCount, bool lowHandWins, SKey& key )
+    {
+        if ( numWild > sMaxSubstitutes )
+            return false;
+
+        key = SKey();
+        for ( auto&& ii : dealtCards )
+        {
+            auto rank = ( ii >> 8 ) & 0x0F;
+            size_t suit = 0;
+            switch ( ( ii >> 12 ) & 0x0F )
+            {
+                case 0b0001: suit = 0; break;
+                case 0b0010: suit = 1; break;
+                case 0b0100: suit = 2; break;
+                case 0b1000: suit = 3; break;
+                default: return false;
+            }
+            if ( rank >= 13 )
+                return false;
+            key.fCards |= uint64_t( 1 ) << ( suit * 13 + rank );
+        }
+        key.fNumWild = static_cast< uint8_t >( numWild );
+        key.fVariant = static_cast< uint8_t >( SCardInfoData::toWhichItem( straightsAndFlushesCount, lowHandWins ) );
+        return true;
+    }
+
+    size_t CWildCardCache::SKeyHash::operator()( const SKey& key ) const
+    {
+        auto value = key.fCards ^ ( uint64_t( key.fNumWild ) << 52 ) ^ ( uint64_t( key.fVariant ) << 60 );
+        value *= 0x9E3779B97F4A7C15ULL;
+        return static_cast< size_t >( value ^ ( value >> 32 ) );
+    }
+
+    CWildCardCache::SShard& CWildCardCache::shard( const SKey& key )
+    {
+        return fShards[ ( SKeyHash()( key ) >> 7 ) % fShards.size() ];
+    }
+
+    size_t CWildCardCache::shardCapacity() const
+    {
+        return ( capacity() + fShards.size() - 1 ) / fShards.size();
+    }
+
+    bool CWildCardCache::find( const SKey& key, SValue& value )
+    {
+        if ( capacity() == 0 )
+            return false;
+
+        auto&& curr = shard( key );
+        std::lock_guard< std::mutex > lock( curr.fMutex );
+        auto pos = curr.fIndex.find( key );
+        if ( pos == curr.fIndex.end() )
+        {
+            fMisses.fetch_add( 1, std::memory_order_relaxed );
+            return false;
+        }
+
+        curr.fEntries.splice( curr.fEntries.begin(), curr.fEntries, ( *pos ).second );
+        value = ( *pos ).second->second;
+        fHits.fetch_add( 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    void CWildCardCache::insert( const SKey& key, const SValue& value )
+    {
+        auto maxSize = shardCapacity();
+        if ( maxSize == 0 )
+            return;
+
+        auto&& curr = shard( key );
+        std::lock_guard< std::mutex > lock( curr.fMutex );
+        auto pos = curr.fIndex.find( key );
+        if ( pos != curr.fIndex.end() )
+        {
+            ( *pos ).second->second = value;
+            curr.fEntries.splice( curr.fEntries.begin(), curr.fEntries, ( *pos ).second );
+            return;
+        }
+
+        curr.fEntries.emplace_front( key, value );
+        curr.fIndex[ key ] = curr.fEntries.begin();
+        trim( curr, maxSize );
+    }
+
+    void CWildCardCache::trim( SShard& shard, size_t shardCapacity )
+    {
+        while ( shard.fEntries.size() > shardCapacity )
+        {
+            shard.fIndex.erase( shard.fEntries.back().first );
+            shard.fEntries.pop_back();
+            fEvictions.fetch_add( 1, std::memory_order_relaxed );
+        }
+    }
+
+    void CWildCardCache::clear()
+    {
+        for ( auto&& ii : fShards )
+        {
+            std::lock_guard< std::mutex > lock( ii.fMutex );
+            ii.fEntries.clear();
+            ii.fIndex.clear();
+        }
+    }
+
+    void CWildCardCache::setCapacity( size_t capacity )
+    {
+        fCapacity.store( capacity, std::memory_order_relaxed );
+        auto maxSize = shardCapacity();
+        for ( auto&& ii : fShards )
+        {
+            std::lock_guard< std::mutex > lock( ii.fMutex );
+            trim( ii, maxSize );
+        }
+    }
+
+    CWildCardCache::SStats CWildCardCache::stats() const
+    {
+        SStats retVal;
+        retVal.fHits = fHits.load( std::memory_order_relaxed );
+        retVal.fMisses = fMisses.load( std::memory_order_relaxed );
+        retVal.fEvictions = fEvictions.load( std::memory_order_relaxed );
+        retVal.fCapacity = capacity();
+        for ( auto&& ii : fShards )
+        {
+            std::lock_guard< std::mutex > lock( ii.fMutex );
+            retVal.fSize += ii.fEntries.size();
+        }
+        return retVal;
+    }
+
+    void CWildCardCache::resetStats()
+    {
+        fHits.store( 0, std::memory_order_relaxed );
+        fMisses.store( 0, std::memory_order_relaxed );
+        fEvictions.store( 0, std::memory_order_relaxed );
+    }
+}
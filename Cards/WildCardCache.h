@@ -0,0 +1,109 @@
+#ifndef __WILDCARDCACHE_H
+#define __WILDCARDCACHE_H
+
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "HandUtils.h"
+#include <array>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+namespace NHandUtils
+{
+    // Results of the wild card solver keyed by the dealt cards, the number of wild cards and the rules
+    // The substitutions are kept rather than the best 5 cards, which cards make the best 5 on a tie depends on the order they were dealt
+    // Bounded, the least recently used entries are evicted first, safe to use from any thread
+    class CWildCardCache
+    {
+    public:
+        static constexpr size_t sMaxSubstitutes = 8;
+
+        struct SKey
+        {
+            bool operator==( const SKey& rhs ) const { return ( fCards == rhs.fCards ) && ( fNumWild == rhs.fNumWild ) && ( fVariant == rhs.fVariant ); }
+
+            uint64_t fCards{ 0 }; // one bit per dealt card that is not wild
+            uint8_t fNumWild{ 0 };
+            uint8_t fVariant{ 0 }; // SCardInfoData::EWhichItem
+        };
+
+        struct SValue
+        {
+            uint32_t fRank{ kNoRank };
+            uint8_t fNumSubstitutes{ 0 };
+            std::array< uint8_t, sMaxSubstitutes > fSubstitutes{}; // indexes into CCard::allCards(), one per wild card in the order they were dealt
+        };
+
+        struct SStats
+        {
+            uint64_t fHits{ 0 };
+            uint64_t fMisses{ 0 };
+            uint64_t fEvictions{ 0 };
+            size_t fSize{ 0 };
+            size_t fCapacity{ 0 };
+        };
+
+        static CWildCardCache& instance();
+        // returns false when the key cant be represented, a card is unknown or there are too many wild cards
+        static bool makeKey( SCardSpan dealtCards, size_t numWild, bool straightsAndFlushesCount, bool lowHandWins, SKey& key );
+
+        bool find( const SKey& key, SValue& value );
+        void insert( const SKey& key, const SValue& value );
+        void clear();
+
+        void setCapacity( size_t capacity ); // 0 disables the cache
+        size_t capacity() const { return fCapacity.load( std::memory_order_relaxed ); }
+
+        SStats stats() const;
+        void resetStats();
+    private:
+        CWildCardCache();
+
+        struct SKeyHash
+        {
+            size_t operator()( const SKey& key ) const;
+        };
+
+        struct SShard
+        {
+            mutable std::mutex fMutex;
+            std::list< std::pair< SKey, SValue > > fEntries; // most recently used first
+            std::unordered_map< SKey, std::list< std::pair< SKey, SValue > >::iterator, SKeyHash > fIndex;
+        };
+
+        SShard& shard( const SKey& key );
+        size_t shardCapacity() const;
+        void trim( SShard& shard, size_t shardCapacity ); // call with the shard locked
+
+        std::array< SShard, 16 > fShards;
+        std::atomic< size_t > fCapacity;
+        std::atomic< uint64_t > fHits{ 0 };
+        std::atomic< uint64_t > fMisses{ 0 };
+        std::atomic< uint64_t > fEvictions{ 0 };
+    };
+}
+
+#endif
@@ -21,12 +21,16 @@
 # SOFTWARE.
 
 set(qtproject_SRCS
+    BoardContext.cpp
     Card.cpp
     CardInfo.cpp
     Evaluate2CardHand.cpp
     Evaluate3CardHand.cpp
     Evaluate4CardHand.cpp
     Evaluate5CardHand.cpp
+    Evaluate6CardHand.cpp
+    Evaluate7CardHand.cpp
+    DerivedCardTables.cpp
     GenerateCardTables.cpp
     2CardHandTables.cpp
     3CardHandTables.cpp
@@ -36,25 +40,40 @@ set(qtproject_SRCS
     Hand.cpp
     HandImpl.cpp
     HandUtils.cpp
+    IncrementalHand.cpp
+    Log.cpp
     Player.cpp
+    Simulation.cpp
+    TableRegistry.cpp
+    WildCardCache.cpp
 )
 
 set(qtproject_H
 )
 
 set(project_H
+    BoardContext.h
     Card.h
     CardInfo.h
     Evaluate2CardHand.h
     Evaluate3CardHand.h
     Evaluate4CardHand.h
     Evaluate5CardHand.h
+    Evaluate6CardHand.h
+    Evaluate7CardHand.h
+    DerivedCardTables.h
     Game.h
     Hand.h
     HandImpl.h
     HandUtils.h
+    IncrementalHand.h
+    Log.h
     Player.h
     PlayInfo.h
+    RandomEngine.h
+    Simulation.h
+    TableRegistry.h
+    WildCardCache.h
 )
 
 set(qtproject_UIS
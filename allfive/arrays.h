@@ -2,6 +2,8 @@
 #define __ARRAYS_H
 
 #include <unordered_map>
+#include <cstdint>
+#include <cstddef>
 #include <vector>
 /*
 ** this is a table lookup for all "flush" hands (e.g.  both
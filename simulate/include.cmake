@@ -0,0 +1,16 @@
+set(qtproject_SRCS
+    simulate.cpp    
+)
+
+set(qtproject_H
+)
+
+set(project_H
+)
+
+set(qtproject_UIS
+)
+
+
+set(qtproject_QRC
+)
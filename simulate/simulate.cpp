@@ -0,0 +1,287 @@
+// The MIT License( MIT )
+//
+// Copyright( c ) 2020 Scott Aron Bloom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files( the "Software" ), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Headless simulation runner, deals hands with CGame for a number of deals or a fixed time
+// and reports hands per second along with the game statistics as text or JSON
+
+#include "Cards/Game.h"
+#include "Cards/Simulation.h"
+#include "Cards/Player.h"
+#include "Cards/Hand.h"
+#include "Cards/Card.h"
+#include "Cards/Log.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QStringList>
+#include <chrono>
+#include <thread>
+#include <iostream>
+
+struct SSimulationResults
+{
+    uint64_t fDeals{ 0 };
+    double fSeconds{ 0.0 };
+    double dealsPerSecond() const { return ( fSeconds > 0 ) ? ( fDeals / fSeconds ) : 0.0; }
+};
+
+static bool getNumber( const QCommandLineParser & parser, const QString & optionName, uint64_t & value, QString & errorMsg )
+{
+    if ( !parser.isSet( optionName ) )
+        return true;
+
+    bool aOK = false;
+    value = parser.value( optionName ).toULongLong( &aOK );
+    if ( !aOK )
+        errorMsg = QString( "Invalid value for --%1: '%2'" ).arg( optionName ).arg( parser.value( optionName ) );
+    return aOK;
+}
+
+static bool configureGame( CGame & game, const QCommandLineParser & parser, QString & errorMsg )
+{
+    uint64_t numPlayers = 4;
+    uint64_t numCards = 5;
+    uint64_t numBoardCards = 0;
+    if ( !getNumber( parser, "players", numPlayers, errorMsg ) || !getNumber( parser, "cards", numCards, errorMsg ) || !getNumber( parser, "board", numBoardCards, errorMsg ) )
+        return false;
+
+    if ( ( numPlayers == 0 ) || ( numCards == 0 ) || ( ( numPlayers * numCards + numBoardCards ) > 52 ) )
+    {
+        errorMsg = QString( "Can not deal %1 cards to %2 players with %3 board cards from one deck" ).arg( numCards ).arg( numPlayers ).arg( numBoardCards );
+        return false;
+    }
+
+    for ( uint64_t ii = 0; ii < numPlayers; ++ii )
+        game.addPlayer( QString( "Player %1" ).arg( ii + 1 ) );
+    game.setNumCards( static_cast< uint8_t >( numCards ) );
+    game.setNumBoardCards( static_cast< uint8_t >( numBoardCards ) );
+
+    if ( parser.isSet( "hole-cards" ) )
+    {
+        uint64_t numHoleCards = 0;
+        if ( !getNumber( parser, "hole-cards", numHoleCards, errorMsg ) )
+            return false;
+        if ( ( numHoleCards > numCards ) || ( numHoleCards > 5 ) || ( ( 5 - numHoleCards ) > numBoardCards ) )
+        {
+            errorMsg = QString( "Can not play exactly %1 hole cards with %2 cards and %3 board cards" ).arg( numHoleCards ).arg( numCards ).arg( numBoardCards );
+            return false;
+        }
+        game.setNumHoleCardsUsed( static_cast< uint8_t >( numHoleCards ) );
+    }
+
+    for ( auto&& ii : parser.values( "wild" ) )
+    {
+        auto wildCards = game.getCards( ii );
+        if ( wildCards.empty() )
+        {
+            errorMsg = QString( "Invalid wild cards: '%1'" ).arg( ii );
+            return false;
+        }
+        game.addWildCards( wildCards );
+    }
+
+    game.setLowHandWins( parser.isSet( "low-ball" ) );
+    game.setStraightsAndFlushesCount( !parser.isSet( "no-straights-flushes" ) );
+    game.setHiLoSplit( parser.isSet( "hi-lo" ) );
+    return true;
+}
+
+static SSimulationResults runSimulation( CSimulation & simulation, uint64_t numDeals, double maxSeconds )
+{
+    SSimulationResults retVal;
+    auto startTime = std::chrono::steady_clock::now();
+    if ( maxSeconds > 0 )
+    {
+        simulation.start( numDeals );
+        auto endTime = startTime + std::chrono::duration_cast< std::chrono::steady_clock::duration >( std::chrono::duration< double >( maxSeconds ) );
+        while ( simulation.running() && ( std::chrono::steady_clock::now() < endTime ) )
+            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+        simulation.stop();
+    }
+    else
+        simulation.run( numDeals );
+
+    retVal.fDeals = simulation.stats().fNumDeals;
+    retVal.fSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - startTime ).count();
+    return retVal;
+}
+
+static QJsonObject toJson( const CGame & game, size_t numThreads, const SGameStats & stats, const SSimulationResults & results )
+{
+    QJsonObject config;
+    config[ "players" ] = static_cast< qint64 >( game.players().size() );
+    QJsonArray cards;
+    for ( auto&& ii : game.cardDeal() )
+        cards.append( ii );
+    config[ "cards" ] = cards;
+    config[ "board" ] = game.numBoardCards();
+    if ( game.numHoleCardsUsed().has_value() )
+        config[ "holeCards" ] = game.numHoleCardsUsed().value();
+    config[ "lowBall" ] = game.lowHandWins();
+    config[ "straightsAndFlushesCount" ] = game.straightsAndFlushesCount();
+    config[ "hiLo" ] = game.hiLoSplit();
+    config[ "threads" ] = static_cast< qint64 >( numThreads );
+
+    QJsonObject winsByPlayer;
+    for ( auto&& ii : game.players() )
+        winsByPlayer[ ii->name() ] = static_cast< qint64 >( stats.fWinsByPlayer[ ii->playerID() ] );
+
+    QJsonObject winsByHand;
+    QJsonObject handCount;
+    for ( auto&& ii : EHand() )
+    {
+        winsByHand[ toString( ii, false ) ] = static_cast< qint64 >( stats.fWinsByHand[ static_cast< size_t >( ii ) ] );
+        handCount[ toString( ii, false ) ] = static_cast< qint64 >( stats.fHandCount[ static_cast< size_t >( ii ) ] );
+    }
+
+    QJsonObject retVal;
+    retVal[ "config" ] = config;
+    retVal[ "deals" ] = static_cast< qint64 >( results.fDeals );
+    retVal[ "games" ] = static_cast< qint64 >( stats.fNumGames );
+    retVal[ "lowWins" ] = static_cast< qint64 >( stats.fLowWins );
+    retVal[ "seconds" ] = results.fSeconds;
+    retVal[ "dealsPerSecond" ] = results.dealsPerSecond();
+    retVal[ "winsByPlayer" ] = winsByPlayer;
+    retVal[ "winsByHand" ] = winsByHand;
+    retVal[ "handCount" ] = handCount;
+    return retVal;
+}
+
+int main( int argc, char ** argv )
+{
+    QCoreApplication appl( argc, argv );
+    appl.setApplicationName( "CardSim" );
+    appl.setApplicationVersion( "0.9" );
+    appl.setOrganizationName( "Scott Aron Bloom" );
+    appl.setOrganizationDomain( "www.towel42.com" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Deals poker hands without a display and reports the statistics" );
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addOptions(
+        {
+             { { "p", "players" }, "Number of players (default 4)", "count" }
+            ,{ { "c", "cards" }, "Number of cards dealt to each player (default 5)", "count" }
+            ,{ { "b", "board" }, "Number of community cards (default 0)", "count" }
+            ,{ "hole-cards", "Play exactly this many of each players cards with the board, Omaha is 2 (default any 5)", "count" }
+            ,{ { "w", "wild" }, "Wild cards, may be repeated (ie \"2C 2D 2H 2S\")", "cards" }
+            ,{ { "l", "low-ball" }, "Low hand wins" }
+            ,{ "no-straights-flushes", "Straights and flushes do not count" }
+            ,{ "hi-lo", "Split the pot between the high and the 8 or better low" }
+            ,{ { "n", "deals" }, "Number of deals to run (default 100,000 unless --seconds is set)", "count" }
+            ,{ { "s", "seconds" }, "Run for this many seconds", "seconds" }
+            ,{ { "t", "threads" }, "Number of threads dealing, 0 is one per hardware thread (default 1)", "count" }
+            ,{ "seed", "Seed the deals, a seeded run deals the same cards on any number of threads", "seed" }
+            ,{ "replay", "Deal only this deal of the --seed run and show it", "index" }
+            ,{ "json", "Report as JSON" }
+            ,{ "history", "Write a hand history line per deal to this file", "file" }
+            ,{ "trace", "Trace every deal to stderr, or to the --history file" }
+        } );
+    parser.process( appl );
+
+    CGame game;
+    QString errorMsg;
+    uint64_t numDeals = parser.isSet( "seconds" ) ? 0 : 100000;
+    if ( !configureGame( game, parser, errorMsg ) || !getNumber( parser, "deals", numDeals, errorMsg ) )
+    {
+        std::cerr << qPrintable( errorMsg ) << "\n";
+        return 1;
+    }
+
+    double maxSeconds = 0;
+    if ( parser.isSet( "seconds" ) )
+    {
+        bool aOK = false;
+        maxSeconds = parser.value( "seconds" ).toDouble( &aOK );
+        if ( !aOK || ( maxSeconds <= 0 ) )
+        {
+            std::cerr << "Invalid value for --seconds: '" << qPrintable( parser.value( "seconds" ) ) << "'\n";
+            return 1;
+        }
+    }
+
+    uint64_t numThreads = 1;
+    std::optional< uint64_t > seed;
+    if ( parser.isSet( "seed" ) )
+        seed = 0;
+    if ( !getNumber( parser, "threads", numThreads, errorMsg ) || ( seed.has_value() && !getNumber( parser, "seed", seed.value(), errorMsg ) ) )
+    {
+        std::cerr << qPrintable( errorMsg ) << "\n";
+        return 1;
+    }
+
+    if ( parser.isSet( "history" ) )
+    {
+        auto writer = std::make_shared< CAsyncLogWriter >( parser.value( "history" ).toStdString() );
+        if ( !writer->isOpen() )
+        {
+            std::cerr << "Could not open --history file: '" << qPrintable( parser.value( "history" ) ) << "'\n";
+            return 1;
+        }
+        CLog::setSink( writer );
+        CLog::setLevel( ELogLevel::eInfo );
+    }
+    if ( parser.isSet( "trace" ) )
+        CLog::setLevel( ELogLevel::eTrace );
+
+    if ( parser.isSet( "replay" ) )
+    {
+        uint64_t dealIndex = 0;
+        if ( !seed.has_value() )
+            errorMsg = "--replay requires --seed";
+        if ( !seed.has_value() || !getNumber( parser, "replay", dealIndex, errorMsg ) )
+        {
+            std::cerr << qPrintable( errorMsg ) << "\n";
+            return 1;
+        }
+        game.shuffleAndDeal( seed.value(), dealIndex ); // dealing finds the winners
+        std::cout << qPrintable( game.dumpGame( false ) );
+        return 0;
+    }
+
+    CSimulation simulation( game, numThreads );
+    simulation.setSeed( seed );
+
+    auto results = runSimulation( simulation, numDeals, maxSeconds );
+    CLog::sink()->flush();
+
+    auto stats = simulation.stats();
+    if ( parser.isSet( "json" ) )
+    {
+        std::cout << QJsonDocument( toJson( game, simulation.numThreads(), stats, results ) ).toJson().toStdString();
+        return 0;
+    }
+
+    std::cout << "=================================\n";
+    std::cout << "Deals: " << results.fDeals << "\n";
+    std::cout << "Seconds: " << results.fSeconds << "\n";
+    std::cout << "Threads: " << simulation.numThreads() << "\n";
+    std::cout << "Deals/Second: " << results.dealsPerSecond() << "\n";
+    std::cout << "=================================\n";
+    std::cout << qPrintable( game.dumpStats( stats ) );
+    return 0;
+}